@@ -65,6 +65,9 @@
 // Mouse Turbo Click - use new keycode name
 #define MOUSE_TURBO_CLICK_KEY MS_BTN1
 
+// Latency Stats, when enabled in rules.mk
+#define LATENCY_STATS_NUM_STAGES 8
+
 // PaletteFx
 #define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_CUSTOM_PALETTEFX_FLOW
 #define RGB_MATRIX_CUSTOM_USER
@@ -22,13 +22,8 @@
 
 #include "autocorrection.h"
 
-#include <string.h>
-
 #include "autocorrection_data.h"
 
-#pragma message \
-    "Autocorrect is now a core QMK feature! To use it, update your QMK set up and see https://docs.qmk.fm/#/feature_autocorrect"
-
 #if AUTOCORRECTION_MIN_LENGTH < 4
 // Odd output or hard locks on the board have been observed when the min typo
 // length is 3 or lower (https://github.com/getreuer/qmk-keymap/issues/2).
@@ -37,170 +32,357 @@
 #error "Min typo length is less than 4. Autocorrection may behave poorly."
 #endif
 
-bool process_autocorrection(uint16_t keycode, keyrecord_t* record) {
-  static uint8_t typo_buffer[AUTOCORRECTION_MAX_LENGTH] = {0};
-  static uint8_t typo_buffer_size = 0;
+// Most keys remembered: AUTOCORRECTION_MAX_LENGTH rounded up to a power of 2,
+// and an unsigned type with a bit for each. Dictionaries loaded into flash may
+// have typos up to 64 keys long.
+#if defined(AUTOCORRECTION_FLASH_ENABLE) || AUTOCORRECTION_MAX_LENGTH > 32
+#define KEY_CAPACITY 64
+typedef uint64_t key_bits_t;
+#elif AUTOCORRECTION_MAX_LENGTH > 16
+#define KEY_CAPACITY 32
+typedef uint32_t key_bits_t;
+#else
+#define KEY_CAPACITY 16
+typedef uint16_t key_bits_t;
+#endif
+#if AUTOCORRECTION_MAX_LENGTH > 64
+#error "Max typo length is over 64. Autocorrection supports at most 64."
+#endif
+#if TEXT_HISTORY_SIZE < KEY_CAPACITY
+// The keys are read from the text history.
+#error "autocorrection: TEXT_HISTORY_SIZE is less than the max typo length"
+#endif
+
+// The dictionary in use, by default `autocorrection_data`, is an Aho-Corasick
+// automaton over the typed keys: the trie of typos with a failure link in each
+// state, its equivalent states merged. Its current state, an index into
+// `data`, is that of the longest prefix of a typo that the typed keys end with,
+// so each key is a transition, after following failure links while the state
+// has none for the key.
+static const uint8_t* data = autocorrection_data;
+static uint16_t data_size = sizeof(autocorrection_data);
+static uint8_t max_length = AUTOCORRECTION_MAX_LENGTH;
+static uint16_t state = 0;
+
+// The keys typed since the last reset, up to `max_length` of them, read from
+// the shared text history (see features/text_event.h). Backspace undoes a key
+// by replaying the automaton over the keys before it, rather than keeping the
+// state before each key.
+static text_history_cursor_t keys = {0};
+
+// A bit for each of the same keys, the newest in bit 0: whether it was typed
+// with Shift. An apostrophe takes the bit of the key before it in the word, so
+// that it does not count toward the case. Unlike the history's, this includes
+// one-shot Shift that Sentence Case applies after the key is appended.
+static key_bits_t shift_bits = 0;
+
+// Buffer for a correction with the typo's capitalization applied. Size 0 turns
+// recasing off, sending corrections as written like QMK core's Autocorrect.
+#ifndef AUTOCORRECTION_RECASE_SIZE
+#define AUTOCORRECTION_RECASE_SIZE 32
+#endif  // AUTOCORRECTION_RECASE_SIZE
+#if AUTOCORRECTION_RECASE_SIZE > 0
+static char recased[AUTOCORRECTION_RECASE_SIZE];
+#endif  // AUTOCORRECTION_RECASE_SIZE > 0
+// The correction being applied, if recased: `recased`, otherwise NULL.
+static const char* recased_correction = NULL;
+
+static void reset_state(void) {
+  state = 0;
+  keys.count = 0;
+}
+
+// Reads the 16-bit little endian value at `index` of `data`.
+static uint16_t read_u16(uint16_t index) {
+  return (uint16_t)((uint_fast16_t)pgm_read_byte(data + index) |
+                    (uint_fast16_t)pgm_read_byte(data + index + 1) << 8);
+}
+
+// Finds the transition on the key with bitmap bit `bit` in the state at index
+// `from`. Returns the index of the next state, or 0 if the state has none.
+static uint16_t find_transition(uint16_t from, uint8_t bit) {
+  const uint8_t code = pgm_read_byte(data + from);
+  if (code >= 192) {
+    return 0;  // A leaf.
+  }
+  // Skip the failure depth byte if there is one.
+  const uint16_t i = from + 1 + (code >= 160);
+  if ((code & 31) == 30) {
+    // The state has one transition, to a state shared with other prefixes: its
+    // key's bit, then its link.
+    return (pgm_read_byte(data + i) == bit) ? read_u16(i + 1) : 0;
+  }
+  if ((code & 31) != 31) {
+    // The state has one transition, on the key in the low bits. The next state
+    // follows.
+    return ((code & 31) == bit) ? i : 0;
+  }
+
+  // The state has a bitmap of which keys have a transition, followed by a
+  // link for each. The rank of the key's bit among the set bits gives the
+  // index of its link.
+  const uint32_t bitmap = (uint32_t)pgm_read_byte(data + i) |
+                          (uint32_t)pgm_read_byte(data + i + 1) << 8 |
+                          (uint32_t)pgm_read_byte(data + i + 2) << 16 |
+                          (uint32_t)pgm_read_byte(data + i + 3) << 24;
+  if (!((bitmap >> bit) & 1)) {
+    return 0;
+  }
+  return read_u16(
+      i + 4 + 2 * __builtin_popcount(bitmap & ((UINT32_C(1) << bit) - 1)));
+}
 
+// Gets the bitmap bit of an automaton key. Keys here are only A-Z, space and '.
+static uint8_t key_bit(uint8_t key) {
+  return (key <= KC_Z) ? key - KC_A : (key == KC_SPC) ? 26 : 27;
+}
+
+// Gets the automaton's key for the key `n` keys back: A-Z and ' as they are,
+// and word breaks, including ", as KC_SPC.
+static uint8_t key_back(uint8_t n) {
+  const uint8_t keycode = text_history_keycode(&keys, n);
+  if ((KC_A <= keycode && keycode <= KC_Z) ||
+      (keycode == KC_QUOT && !text_history_shifted(&keys, n))) {
+    return keycode;
+  }
+  return KC_SPC;
+}
+
+// Gets the state after the key `n` keys back in state `from`, which the keys
+// before it led to.
+static uint16_t next_state(uint16_t from, uint8_t n) {
+  const uint8_t bit = key_bit(key_back(n));
+  uint8_t code = pgm_read_byte(data + from);
+  if (code >= 192) {
+    from = 0;  // After a typo, the automaton starts over.
+  }
+  for (;;) {
+    const uint16_t to = find_transition(from, bit);
+    if (to || !from) {
+      return to;
+    }
+    // Follow the failure link. It is stored as its depth: the state is that of
+    // the last keys before this one, that many of them, walked from state 0.
+    code = pgm_read_byte(data + from);
+    uint8_t depth = (code >= 160) ? pgm_read_byte(data + from + 1) : code >> 5;
+    for (from = 0; depth; --depth) {
+      from = find_transition(from, key_bit(key_back(n + depth)));
+    }
+  }
+}
+
+// Sets `state` by typing the remembered keys from state 0. The state depends
+// on at most the last `max_length - 1` keys, since a typo as long as that is
+// corrected, so this is the state as it was after typing them.
+static void replay_state(void) {
+  state = 0;
+  for (uint8_t n = keys.count; n > 0 && state < data_size;) {
+    state = next_state(state, --n);
+  }
+}
+
+// Applies the capitalization of the word being corrected to the correction
+// `str`, which replaces the last `backspaces` keys sent. If every key of the
+// word was shifted, as with Caps Word, the correction is all caps. If only the
+// first was, as at the start of a sentence, and the correction retypes the
+// word from its first letter, the correction starts with a capital. The word
+// is the keys up to the last word break, or as many as are remembered.
+// Returns the recased copy in RAM, or NULL if `str`, in PROGMEM, is sent as is.
+static const char* recase(const char* str, uint8_t backspaces,
+                          bool word_break_ending) {
+#if AUTOCORRECTION_RECASE_SIZE == 0
+  return NULL;
+#else
+  uint8_t first = word_break_ending;
+  uint8_t i = first;
+  while (i < keys.count && key_back(i) != KC_SPC) {
+    ++i;
+  }
+  if (i == first) {
+    return NULL;
+  }
+  // The word is keys `first` to `i - 1` back, its first key at `i - 1`.
+  const key_bits_t word =
+      (key_bits_t) ~(key_bits_t)0 >> (8 * sizeof(key_bits_t) - (i - first));
+  const key_bits_t shifted = (shift_bits >> first) & word;
+  const bool all_caps = i - first >= 2 && shifted == word;
+  const bool title = shifted == (word >> 1) + 1 && backspaces == i - 1;
+  if (!all_caps && !title) {
+    return NULL;
+  }
+
+  for (uint8_t j = 0;; ++j) {
+    if (j == sizeof(recased)) {
+      return NULL;  // Too long, send it as is.
+    }
+    char c = pgm_read_byte(str + j);
+    if ((all_caps || j == 0) && 'a' <= c && c <= 'z') {
+      c += 'A' - 'a';
+    }
+    recased[j] = c;
+    if (!c) {
+      break;
+    }
+  }
+  return recased;
+#endif  // AUTOCORRECTION_RECASE_SIZE == 0
+}
+
+#if !defined(AUTOCORRECT_ENABLE) && !defined(AUTOCORRECTION_FLASH_ENABLE)
+// With AUTOCORRECT_ENABLE, QMK core (or tools/sim, standing in for it) defines
+// this default instead, and with AUTOCORRECTION_FLASH_ENABLE, keymap.c defines
+// apply_autocorrect() itself.
+__attribute__((weak)) bool apply_autocorrect(uint8_t backspaces,
+                                             const char* str, char* typo,
+                                             char* correct) {
+  return true;
+}
+#endif  // !AUTOCORRECT_ENABLE && !AUTOCORRECTION_FLASH_ENABLE
+
+const char* autocorrection_get_recased(void) { return recased_correction; }
+
+void autocorrection_set_data(const uint8_t* new_data, uint16_t size,
+                             uint8_t new_max_length) {
+  if (new_data) {
+    data = new_data;
+    data_size = size;
+    max_length =
+        new_max_length < KEY_CAPACITY ? new_max_length : KEY_CAPACITY;
+  } else {
+    data = autocorrection_data;
+    data_size = sizeof(autocorrection_data);
+    max_length = AUTOCORRECTION_MAX_LENGTH;
+  }
+  reset_state();
+}
+
+bool process_autocorrection(uint16_t keycode, keyrecord_t* record) {
   // Ignore key release; we only process key presses.
   if (!record->event.pressed) {
     return true;
   }
+  text_event_t event;
+  text_event_normalize(&event, keycode, record);
+  text_history_append(&event, record);
+  return process_autocorrection_event(&event, record);
+}
 
-#ifndef NO_ACTION_ONESHOT
-  const uint8_t mods = get_mods() | get_oneshot_mods();
-#else
-  const uint8_t mods = get_mods();
-#endif  // NO_ACTION_ONESHOT
+bool process_autocorrection_event(const text_event_t* event,
+                                  keyrecord_t* record) {
+  // Ignore key release; we only process key presses.
+  if (!record->event.pressed) {
+    return true;
+  }
+  // Follow the text history over this key. Keys missed, like those that
+  // handlers before this one consumed, start the keys over.
+  if (!text_history_follow(&keys, max_length)) {
+    state = 0;
+  }
   // Disable autocorrection while a mod other than shift is active.
-  if ((mods & ~MOD_MASK_SHIFT) != 0) {
-    typo_buffer_size = 0;
+  if ((event->mods & ~MOD_MASK_SHIFT) != 0) {
+    reset_state();
     return true;
   }
+  // Caps Word applies Shift as a weak mod, and keycodes like KC_EXLM are
+  // shifted basic keycodes.
+  bool shifted = (event->mods & MOD_MASK_SHIFT) != 0;
+  uint16_t keycode = event->keycode;
 
-  // The following switch cases address various kinds of keycodes. This logic is
-  // split over two switches rather than merged into one. The first switch may
-  // extract a basic keycode which is then further handled by the second switch,
-  // e.g. a layer-tap key with Caps Lock `LT(layer, KC_CAPS)`.
-  switch (keycode) {
-#ifndef NO_ACTION_TAPPING
-    case QK_MOD_TAP ... QK_MOD_TAP_MAX:  // Tap-hold keys.
-#ifndef NO_ACTION_LAYER
-    case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
-#endif  // NO_ACTION_LAYER
-      // Ignore when tap-hold keys are held.
-      if (record->tap.count == 0) {
-        return true;
-      }
-      // Otherwise when tapped, get the basic keycode.
-      // Fallthrough intended.
-#endif  // NO_ACTION_TAPPING
-
-    // Handle shifted keys, e.g. symbols like KC_EXLM = S(KC_1).
-    case QK_LSFT ... QK_LSFT + 255:
-    case QK_RSFT ... QK_RSFT + 255:
-      keycode = QK_MODS_GET_BASIC_KEYCODE(keycode);
-      break;
-
-      // NOTE: Space Cadet keys expose no info to check whether they are being
-      // tapped vs. held. This makes autocorrection ambiguous, e.g. KC_LCPO
-      // might be '(', which we would treat as a word break, or it might be
-      // shift, which we would treat as having no effect. To behave cautiously,
-      // we allow Space Cadet keycodes to fall to the logic below and clear
-      // autocorrection state.
+  // Ignore shifts, one-shot mods, layer switch keys and held tap-hold keys.
+  // Other mods may start a hotkey, so they end the word.
+  if (!event->is_tap) {
+    if (IS_MODIFIER_KEYCODE(keycode) && !(MOD_BIT(keycode) & MOD_MASK_SHIFT)) {
+      reset_state();
+    }
+    return true;
   }
 
+  // NOTE: Space Cadet keys expose no info to check whether they are being
+  // tapped vs. held. This makes autocorrection ambiguous, e.g. KC_LCPO might
+  // be '(', which we would treat as a word break, or it might be shift, which
+  // we would treat as having no effect. To behave cautiously, we allow Space
+  // Cadet keycodes to fall to the logic below and clear autocorrection state.
   switch (keycode) {
-    // Ignore shifts, Caps Lock, one-shot mods, and layer switch keys.
+    // Ignore KC_NO and Caps Lock.
     case KC_NO:
-    case KC_LSFT:
-    case KC_RSFT:
     case KC_CAPS:
-    case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
-    case QK_TO ... QK_TO_MAX:
-    case QK_MOMENTARY ... QK_MOMENTARY_MAX:
-    case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:
-    case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
-    case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
-    case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
-    case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
-      return true;  // Ignore these keys.
+      return true;
   }
 
   if (keycode == KC_QUOT) {
     // Treat " (shifted ') as a word boundary.
-    if ((mods & MOD_MASK_SHIFT) != 0) {
+    if (shifted) {
       keycode = KC_SPC;
     }
   } else if (!(KC_A <= keycode && keycode <= KC_Z)) {
     if (keycode == KC_BSPC) {
-      // Remove last character from the buffer.
-      if (typo_buffer_size > 0) {
-        --typo_buffer_size;
-      }
+      // Go back to the state before the last key, which the text history has
+      // dropped.
+      shift_bits >>= 1;
+      replay_state();
       return true;
     } else if (KC_1 <= keycode && keycode <= KC_SLSH && keycode != KC_ESC) {
       // Set a word boundary if space, period, digit, etc. is pressed.
       // Behave more conservatively for the enter key. Reset, so that enter
       // can't be used on a word ending.
       if (keycode == KC_ENT) {
-        typo_buffer_size = 0;
+        reset_state();
+        keys.count = 1;
       }
       keycode = KC_SPC;
     } else {
       // Clear state if some other non-alpha key is pressed.
-      typo_buffer_size = 0;
+      reset_state();
       return true;
     }
   }
 
-  // If the buffer is full, rotate it to discard the oldest character.
-  if (typo_buffer_size >= AUTOCORRECTION_MAX_LENGTH) {
-    memmove(typo_buffer, typo_buffer + 1, AUTOCORRECTION_MAX_LENGTH - 1);
-    typo_buffer_size = AUTOCORRECTION_MAX_LENGTH - 1;
+  // Advance the automaton by `keycode`, the newest of `keys`.
+  // NOTE: `keycode` must be a basic keycode (0-255) by this point.
+  if (keycode == KC_SPC) {
+    shifted = false;
+  } else if (keycode == KC_QUOT) {
+    shifted = keys.count > 1 && key_back(1) != KC_SPC && (shift_bits & 1);
   }
+  shift_bits = shift_bits << 1 | shifted;
+  state = next_state(state, 0);
 
-  // Append `keycode` to the buffer.
-  // NOTE: `keycode` must be a basic keycode (0-255) by this point.
-  typo_buffer[typo_buffer_size++] = (uint8_t)keycode;
-  // Early return if not many characters have been buffered so far.
-  if (typo_buffer_size < AUTOCORRECTION_MIN_LENGTH) {
+  // Stop if `state` becomes an invalid index. This should not normally
+  // happen, it is a safeguard in case of a bug, data corruption, etc.
+  if (state >= data_size) {
+    reset_state();
     return true;
   }
 
-  // Check whether the buffer ends in a typo. This is done using a trie
-  // stored in `autocorrection_data`.
-  uint16_t state = 0;
-  uint8_t code = pgm_read_byte(autocorrection_data + state);
-  for (int i = typo_buffer_size - 1; i >= 0; --i) {
-    const uint8_t key_i = typo_buffer[i];
-
-    if (code & 64) {  // Check for match in node with multiple children.
-      code &= 63;
-      for (; code != key_i;
-           code = pgm_read_byte(autocorrection_data + (state += 3))) {
-        if (!code) {
-          return true;
-        }
-      }
-
-      // Follow link to child node.
-      state = (uint16_t)((uint_fast16_t)pgm_read_byte(autocorrection_data +
-                                                      state + 1) |
-                         (uint_fast16_t)pgm_read_byte(autocorrection_data +
-                                                      state + 2)
-                             << 8);
-      // Otherwise check for match in node with a single child.
-    } else if (code != key_i) {
-      return true;
-    } else if (!(code = pgm_read_byte(autocorrection_data + (++state)))) {
-      ++state;
-    }
-
-    // Stop if `state` becomes an invalid index. This should not normally
-    // happen, it is a safeguard in case of a bug, data corruption, etc.
-    if (state >= sizeof(autocorrection_data)) {
-      return true;
-    }
-
-    // Read first byte of the next node.
-    code = pgm_read_byte(autocorrection_data + state);
-
-    if (code & 128) {  // A typo was found! Apply autocorrection.
-      const int backspaces = code & 63;
-      for (int i = 0; i < backspaces; ++i) {
+  const uint8_t code = pgm_read_byte(data + state);
+  if (code >= 192) {  // A typo was found! Apply autocorrection.
+    const uint8_t backspaces = code & 63;
+    // The correction is in the string pool at the end of the data, in
+    // PROGMEM. A recased copy is in RAM, which send_string_P() would misread
+    // on AVR.
+    const char* str = (const char*)(data + read_u16(state + 1));
+    recased_correction = recase(str, backspaces, keycode == KC_SPC);
+    if (apply_autocorrect(backspaces, str, NULL, NULL)) {
+      for (uint8_t i = 0; i < backspaces; ++i) {
         tap_code(KC_BSPC);
       }
-      send_string_P((char const*)(autocorrection_data + state + 1));
-
-      if (keycode == KC_SPC) {
-        typo_buffer[0] = KC_SPC;
-        typo_buffer_size = 1;
-        return true;
+      if (recased_correction) {
+        send_string(recased_correction);
       } else {
-        typo_buffer_size = 0;
-        return false;
+        send_string_P(str);
       }
     }
+    recased_correction = NULL;
+
+    reset_state();
+    if (keycode == KC_SPC) {
+      keys.count = 1;
+      shift_bits = 0;
+      state = next_state(0, 0);
+      return true;
+    } else {
+      return false;
+    }
   }
 
   return true;
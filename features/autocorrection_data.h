@@ -269,222 +269,217 @@
 #define AUTOCORRECTION_MIN_LENGTH 5  // ":ture"
 #define AUTOCORRECTION_MAX_LENGTH 14  // "infrastrucutre"
 
-static const uint8_t autocorrection_data[4166] PROGMEM = {108, 61, 0, 4, 142, 0,
-  6, 167, 0, 7, 249, 0, 8, 160, 1, 9, 212, 5, 10, 237, 5, 11, 56, 6, 12, 113, 6,
-  14, 123, 6, 15, 137, 6, 16, 255, 6, 17, 61, 7, 18, 47, 9, 19, 92, 9, 21, 117,
-  9, 22, 41, 11, 23, 192, 11, 26, 226, 14, 28, 237, 14, 0, 72, 74, 0, 17, 84, 0,
-  22, 93, 0, 23, 104, 0, 0, 11, 23, 44, 8, 11, 23, 44, 0, 132, 0, 23, 12, 21,
-  19, 0, 130, 110, 116, 0, 8, 22, 18, 18, 15, 0, 132, 115, 101, 115, 0, 76, 114,
-  0, 18, 123, 0, 21, 133, 0, 0, 16, 18, 6, 0, 130, 109, 105, 116, 0, 15, 4, 44,
-  0, 131, 32, 108, 111, 116, 0, 19, 27, 8, 0, 130, 111, 114, 116, 0, 72, 149, 0,
-  28, 159, 0, 0, 16, 11, 6, 22, 0, 130, 101, 109, 97, 0, 7, 18, 23, 0, 129, 97,
-  121, 0, 75, 177, 0, 12, 212, 0, 14, 225, 0, 0, 81, 184, 0, 23, 204, 0, 0, 68,
-  191, 0, 28, 198, 0, 0, 21, 5, 0, 129, 99, 104, 0, 22, 4, 0, 129, 99, 0, 12,
-  26, 22, 0, 129, 99, 104, 0, 16, 17, 4, 28, 7, 0, 132, 110, 97, 109, 105, 99,
-  0, 68, 232, 0, 8, 242, 0, 0, 5, 15, 15, 4, 6, 0, 129, 99, 107, 0, 11, 6, 0,
-  129, 99, 107, 0, 68, 6, 1, 8, 15, 1, 15, 120, 1, 21, 148, 1, 0, 5, 16, 4, 15,
-  0, 129, 100, 97, 0, 74, 28, 1, 17, 38, 1, 21, 73, 1, 23, 83, 1, 0, 17, 12, 22,
-  0, 131, 103, 110, 101, 100, 0, 12, 9, 0, 71, 48, 1, 8, 59, 1, 0, 17, 24, 0,
-  132, 101, 102, 105, 110, 101, 100, 0, 17, 7, 24, 0, 135, 110, 100, 101, 102,
-  105, 110, 101, 100, 0, 24, 6, 6, 18, 0, 129, 114, 101, 100, 0, 68, 90, 1, 6,
-  106, 1, 0, 6, 21, 8, 19, 8, 7, 0, 134, 114, 101, 99, 97, 116, 101, 100, 0, 4,
-  8, 21, 19, 8, 7, 0, 132, 99, 97, 116, 101, 100, 0, 76, 127, 1, 18, 136, 1, 0,
-  8, 28, 0, 131, 105, 101, 108, 100, 0, 22, 8, 21, 11, 23, 0, 130, 104, 111,
-  108, 100, 0, 4, 26, 18, 9, 0, 131, 114, 119, 97, 114, 100, 0, 68, 212, 1, 5,
-  5, 2, 6, 47, 2, 7, 202, 2, 8, 230, 2, 10, 10, 3, 11, 92, 3, 12, 147, 3, 15,
-  174, 3, 17, 1, 4, 19, 15, 4, 21, 27, 4, 22, 108, 4, 23, 239, 4, 24, 141, 5,
-  25, 183, 5, 29, 195, 5, 0, 70, 219, 1, 21, 248, 1, 0, 73, 226, 1, 19, 237, 1,
-  0, 21, 8, 23, 17, 12, 0, 130, 97, 99, 101, 0, 22, 8, 16, 4, 17, 0, 130, 97,
-  99, 101, 0, 26, 8, 15, 7, 7, 12, 16, 0, 130, 97, 114, 101, 0, 68, 15, 2, 15,
-  25, 2, 21, 34, 2, 0, 15, 12, 4, 25, 4, 0, 128, 108, 101, 0, 24, 18, 7, 0, 130,
-  98, 108, 101, 0, 12, 6, 22, 5, 24, 22, 0, 131, 114, 105, 98, 101, 0, 68, 63,
-  2, 8, 93, 2, 9, 104, 2, 17, 115, 2, 19, 189, 2, 0, 73, 70, 2, 17, 82, 2, 0, 8,
-  23, 17, 12, 0, 131, 114, 102, 97, 99, 101, 0, 23, 22, 17, 12, 0, 131, 97, 110,
-  99, 101, 0, 21, 8, 9, 8, 21, 0, 129, 110, 99, 101, 0, 21, 8, 23, 17, 12, 0,
-  129, 97, 99, 101, 0, 68, 125, 2, 8, 141, 2, 16, 174, 2, 0, 21, 16, 18, 9, 21,
-  8, 19, 0, 133, 114, 109, 97, 110, 99, 101, 0, 85, 148, 2, 23, 163, 2, 0, 8, 9,
-  21, 44, 0, 134, 101, 102, 101, 114, 101, 110, 99, 101, 0, 17, 12, 4, 16, 0,
-  129, 97, 110, 99, 101, 0, 4, 21, 18, 9, 21, 8, 19, 0, 132, 109, 97, 110, 99,
-  101, 0, 4, 22, 8, 16, 4, 17, 0, 131, 112, 97, 99, 101, 0, 12, 21, 8, 25, 0,
-  82, 214, 2, 25, 220, 2, 0, 130, 114, 105, 100, 101, 0, 18, 0, 133, 101, 114,
-  114, 105, 100, 101, 0, 23, 0, 68, 239, 2, 17, 250, 2, 0, 21, 4, 24, 10, 0,
-  130, 110, 116, 101, 101, 0, 4, 21, 24, 4, 10, 0, 135, 117, 97, 114, 97, 110,
-  116, 101, 101, 0, 68, 23, 3, 7, 60, 3, 14, 72, 3, 16, 83, 3, 0, 81, 33, 3, 22,
-  42, 3, 24, 51, 3, 0, 11, 6, 0, 131, 97, 110, 103, 101, 0, 8, 16, 0, 130, 115,
-  97, 103, 101, 0, 10, 44, 0, 131, 97, 117, 103, 101, 0, 8, 15, 12, 25, 12, 21,
-  19, 0, 130, 103, 101, 0, 4, 6, 4, 19, 0, 131, 107, 97, 103, 101, 0, 4, 12, 0,
-  131, 109, 97, 103, 101, 0, 23, 0, 71, 107, 3, 16, 117, 3, 18, 127, 3, 23, 136,
-  3, 0, 17, 4, 44, 0, 130, 32, 116, 104, 101, 0, 18, 21, 9, 0, 130, 32, 116,
-  104, 101, 0, 23, 44, 0, 130, 32, 116, 104, 101, 0, 24, 18, 5, 4, 0, 130, 32,
-  116, 104, 101, 0, 70, 154, 3, 22, 164, 3, 0, 25, 21, 8, 22, 0, 130, 105, 99,
-  101, 0, 16, 18, 21, 19, 0, 130, 105, 115, 101, 0, 69, 181, 3, 22, 249, 3, 0,
-  68, 188, 3, 15, 238, 3, 0, 76, 195, 3, 21, 226, 3, 0, 68, 202, 3, 15, 214, 3,
-  0, 21, 25, 0, 134, 97, 114, 105, 97, 98, 108, 101, 0, 4, 25, 4, 0, 133, 105,
-  108, 97, 98, 108, 101, 0, 12, 4, 25, 0, 133, 114, 105, 97, 98, 108, 101, 0,
-  12, 4, 25, 4, 0, 130, 97, 98, 108, 101, 0, 4, 9, 0, 130, 108, 115, 101, 0, 18,
-  22, 19, 8, 21, 0, 132, 115, 112, 111, 110, 115, 101, 0, 12, 21, 6, 22, 5, 24,
-  22, 0, 129, 98, 101, 0, 68, 43, 4, 8, 59, 4, 12, 70, 4, 23, 82, 4, 24, 100, 4,
-  0, 26, 8, 15, 7, 12, 16, 0, 133, 100, 108, 101, 119, 97, 114, 101, 0, 23, 11,
-  44, 0, 132, 116, 104, 101, 114, 101, 0, 24, 20, 4, 0, 132, 99, 113, 117, 105,
-  114, 101, 0, 24, 6, 24, 21, 23, 22, 4, 21, 9, 17, 12, 0, 131, 116, 117, 114,
-  101, 0, 23, 44, 0, 130, 114, 117, 101, 0, 68, 127, 4, 5, 152, 4, 15, 177, 4,
-  16, 186, 4, 17, 197, 4, 24, 210, 4, 0, 79, 134, 4, 24, 142, 4, 0, 9, 0, 131,
-  97, 108, 115, 101, 0, 6, 8, 5, 0, 131, 97, 117, 115, 101, 0, 4, 0, 72, 161, 4,
-  23, 169, 4, 0, 21, 0, 131, 98, 97, 115, 101, 0, 4, 7, 0, 129, 97, 115, 101, 0,
-  12, 4, 9, 0, 131, 108, 115, 101, 0, 12, 18, 21, 19, 0, 131, 109, 105, 115,
-  101, 0, 18, 19, 8, 21, 0, 132, 115, 112, 111, 110, 115, 101, 0, 68, 217, 4, 6,
-  228, 4, 0, 6, 6, 8, 5, 0, 132, 97, 117, 115, 101, 0, 4, 8, 5, 0, 132, 99, 97,
-  117, 115, 101, 0, 68, 255, 4, 5, 92, 5, 15, 105, 5, 22, 117, 5, 24, 126, 5, 0,
-  71, 9, 5, 15, 46, 5, 21, 80, 5, 0, 18, 16, 0, 80, 19, 5, 18, 34, 5, 0, 18, 6,
-  4, 0, 135, 99, 111, 109, 109, 111, 100, 97, 116, 101, 0, 6, 6, 4, 0, 132, 109,
-  111, 100, 97, 116, 101, 0, 83, 53, 5, 24, 66, 5, 0, 16, 4, 8, 23, 0, 134, 109,
-  112, 108, 97, 116, 101, 0, 6, 24, 15, 4, 6, 0, 134, 99, 117, 108, 97, 116,
-  101, 0, 8, 19, 8, 22, 0, 132, 97, 114, 97, 116, 101, 0, 24, 12, 21, 23, 23, 4,
-  0, 131, 98, 117, 116, 101, 0, 4, 19, 16, 8, 23, 0, 131, 108, 97, 116, 101, 0,
-  26, 8, 12, 25, 0, 129, 101, 116, 0, 5, 21, 12, 23, 23, 4, 0, 133, 114, 105,
-  98, 117, 116, 101, 0, 74, 151, 5, 12, 163, 5, 22, 173, 5, 0, 8, 15, 15, 18, 6,
-  0, 130, 97, 103, 117, 101, 0, 20, 17, 24, 0, 131, 105, 113, 117, 101, 0, 4, 6,
-  8, 5, 0, 130, 117, 115, 101, 0, 8, 12, 6, 8, 21, 0, 131, 101, 105, 118, 101,
-  0, 12, 15, 12, 4, 23, 12, 17, 12, 0, 133, 105, 97, 108, 105, 122, 101, 0, 72,
-  219, 5, 12, 228, 5, 0, 15, 22, 44, 0, 130, 101, 108, 102, 0, 8, 11, 6, 0, 130,
-  105, 101, 102, 0, 73, 247, 5, 12, 1, 6, 17, 10, 6, 0, 12, 17, 18, 6, 0, 130,
-  102, 105, 103, 0, 17, 11, 23, 0, 130, 105, 110, 103, 0, 76, 17, 6, 21, 46, 6,
-  0, 72, 24, 6, 15, 34, 6, 0, 11, 6, 4, 6, 0, 131, 105, 110, 103, 0, 8, 12, 6,
-  0, 133, 101, 105, 108, 105, 110, 103, 0, 12, 23, 22, 0, 131, 114, 105, 110,
-  103, 0, 70, 66, 6, 17, 77, 6, 23, 87, 6, 0, 12, 23, 26, 22, 0, 131, 105, 116,
-  99, 104, 0, 6, 4, 21, 5, 0, 130, 110, 99, 104, 0, 74, 94, 6, 12, 102, 6, 0,
-  12, 8, 11, 0, 129, 104, 116, 0, 26, 7, 17, 4, 5, 0, 129, 100, 116, 104, 0, 23,
-  16, 16, 18, 6, 0, 129, 105, 116, 0, 6, 4, 5, 15, 4, 6, 0, 131, 108, 98, 97,
-  99, 107, 0, 68, 150, 6, 5, 193, 6, 7, 203, 6, 8, 230, 6, 0, 87, 157, 6, 24,
-  182, 6, 0, 76, 164, 6, 24, 172, 6, 0, 17, 12, 0, 129, 105, 97, 108, 0, 21, 12,
-  25, 0, 131, 116, 117, 97, 108, 0, 23, 12, 25, 0, 131, 114, 116, 117, 97, 108,
-  0, 4, 18, 15, 10, 0, 130, 98, 97, 108, 0, 24, 18, 0, 70, 216, 6, 11, 220, 6,
-  26, 226, 6, 0, 129, 108, 100, 0, 22, 0, 129, 108, 100, 0, 129, 108, 100, 0,
-  74, 237, 6, 24, 245, 6, 0, 17, 12, 22, 0, 129, 108, 101, 0, 7, 8, 11, 6, 22,
-  0, 129, 108, 101, 0, 68, 9, 7, 11, 18, 7, 15, 50, 7, 0, 8, 11, 6, 22, 0, 129,
-  109, 97, 0, 76, 25, 7, 23, 38, 7, 0, 23, 21, 18, 10, 15, 4, 0, 131, 105, 116,
-  104, 109, 0, 21, 18, 10, 15, 4, 0, 130, 105, 116, 104, 109, 0, 8, 5, 18, 21,
-  19, 0, 130, 108, 101, 109, 0, 68, 92, 7, 8, 120, 7, 10, 145, 7, 12, 168, 7,
-  14, 181, 7, 18, 189, 7, 21, 246, 8, 23, 1, 9, 24, 13, 9, 26, 36, 9, 0, 76, 99,
-  7, 15, 109, 7, 0, 23, 17, 18, 6, 0, 130, 97, 105, 110, 0, 8, 18, 18, 5, 0,
-  131, 108, 101, 97, 110, 0, 79, 127, 7, 22, 135, 7, 0, 18, 18, 5, 0, 128, 97,
-  110, 0, 18, 18, 11, 6, 0, 131, 115, 101, 110, 0, 12, 0, 82, 154, 7, 21, 161,
-  7, 0, 10, 44, 0, 129, 110, 103, 0, 23, 22, 0, 129, 110, 103, 0, 18, 23, 4, 21,
-  10, 12, 16, 0, 130, 105, 111, 110, 0, 12, 11, 23, 0, 129, 110, 107, 0, 76,
-  199, 7, 22, 128, 8, 23, 157, 8, 0, 86, 206, 7, 23, 6, 8, 0, 68, 219, 7, 8,
-  228, 7, 12, 238, 7, 22, 252, 7, 0, 12, 15, 0, 131, 105, 115, 111, 110, 0, 8,
-  22, 0, 132, 115, 115, 105, 111, 110, 0, 22, 16, 21, 8, 19, 0, 133, 105, 115,
-  115, 105, 111, 110, 0, 4, 6, 6, 18, 0, 131, 105, 111, 110, 0, 68, 25, 8, 7,
-  65, 8, 8, 75, 8, 12, 88, 8, 17, 103, 8, 19, 115, 8, 0, 70, 32, 8, 21, 49, 8,
-  0, 23, 17, 8, 11, 23, 24, 4, 0, 133, 105, 99, 97, 116, 105, 111, 110, 0, 10,
-  12, 9, 17, 18, 6, 0, 133, 117, 114, 97, 116, 105, 111, 110, 0, 7, 4, 0, 131,
-  105, 116, 105, 111, 110, 0, 19, 6, 27, 8, 0, 133, 101, 112, 116, 105, 111,
-  110, 0, 23, 12, 19, 8, 21, 0, 134, 101, 116, 105, 116, 105, 111, 110, 0, 6,
-  24, 9, 0, 133, 110, 99, 116, 105, 111, 110, 0, 8, 27, 8, 0, 133, 99, 101, 112,
-  116, 105, 111, 110, 0, 12, 22, 0, 72, 138, 8, 12, 146, 8, 0, 22, 0, 131, 115,
-  105, 111, 110, 0, 16, 21, 8, 19, 0, 131, 115, 105, 111, 110, 0, 68, 167, 8, 6,
-  200, 8, 12, 218, 8, 0, 85, 174, 8, 29, 187, 8, 0, 24, 10, 12, 9, 17, 18, 6, 0,
-  129, 105, 111, 110, 0, 12, 21, 18, 11, 23, 24, 4, 0, 129, 105, 111, 110, 0, 4,
-  12, 23, 17, 8, 11, 23, 24, 4, 0, 132, 99, 97, 116, 105, 111, 110, 0, 68, 225,
-  8, 6, 236, 8, 0, 21, 10, 12, 16, 0, 131, 116, 105, 111, 110, 0, 17, 24, 9, 0,
-  131, 116, 105, 111, 110, 0, 23, 24, 8, 21, 0, 131, 116, 117, 114, 110, 0, 8,
-  16, 8, 15, 19, 16, 12, 0, 129, 110, 116, 0, 85, 20, 9, 23, 29, 9, 0, 23, 8,
-  21, 0, 130, 117, 114, 110, 0, 8, 21, 0, 128, 114, 110, 0, 18, 14, 17, 24, 0,
-  130, 110, 111, 119, 110, 0, 71, 57, 9, 10, 68, 9, 17, 81, 9, 0, 8, 24, 22, 19,
-  0, 131, 101, 117, 100, 111, 0, 17, 13, 4, 7, 44, 0, 132, 106, 97, 110, 103,
-  111, 0, 10, 4, 13, 7, 44, 0, 130, 110, 103, 111, 0, 87, 99, 9, 24, 108, 9, 0,
-  8, 6, 27, 8, 0, 129, 112, 116, 0, 18, 18, 15, 0, 129, 107, 117, 112, 0, 68,
-  142, 9, 8, 153, 9, 10, 154, 10, 15, 164, 10, 18, 178, 10, 19, 213, 10, 23,
-  224, 10, 29, 29, 11, 0, 12, 15, 12, 16, 12, 22, 0, 130, 97, 114, 0, 68, 181,
-  9, 7, 189, 9, 10, 200, 9, 11, 224, 9, 12, 238, 9, 15, 8, 10, 17, 39, 10, 23,
-  50, 10, 29, 115, 10, 0, 15, 6, 0, 130, 101, 97, 114, 0, 15, 17, 4, 11, 0, 131,
-  100, 108, 101, 114, 0, 72, 207, 9, 24, 215, 9, 0, 16, 44, 0, 130, 114, 103,
-  101, 0, 5, 8, 7, 0, 129, 103, 101, 114, 0, 23, 8, 11, 10, 18, 23, 0, 133, 101,
-  116, 104, 101, 114, 0, 75, 245, 9, 15, 253, 9, 0, 23, 44, 0, 130, 101, 105,
-  114, 0, 19, 16, 18, 6, 0, 131, 105, 108, 101, 114, 0, 79, 15, 10, 23, 30, 10,
-  0, 21, 18, 23, 17, 18, 6, 0, 133, 114, 111, 108, 108, 101, 114, 0, 12, 9, 0,
-  131, 108, 116, 101, 114, 0, 23, 12, 18, 19, 0, 131, 110, 116, 101, 114, 0, 72,
-  60, 10, 12, 92, 10, 16, 104, 10, 0, 68, 67, 10, 22, 82, 10, 0, 16, 4, 21, 19,
-  0, 135, 97, 114, 97, 109, 101, 116, 101, 114, 0, 12, 10, 8, 21, 0, 131, 116,
-  101, 114, 0, 22, 10, 8, 21, 0, 132, 105, 115, 116, 101, 114, 0, 4, 21, 4, 19,
-  0, 130, 101, 116, 101, 114, 0, 12, 15, 0, 68, 125, 10, 12, 140, 10, 0, 12, 21,
-  22, 0, 135, 101, 114, 105, 97, 108, 105, 122, 101, 114, 0, 4, 21, 8, 22, 0,
-  134, 105, 97, 108, 105, 122, 101, 114, 0, 10, 24, 5, 8, 7, 0, 128, 101, 114,
-  0, 4, 24, 6, 12, 23, 21, 4, 19, 0, 130, 108, 97, 114, 0, 23, 0, 68, 187, 10,
-  21, 202, 10, 0, 21, 8, 23, 17, 12, 0, 135, 116, 101, 114, 97, 116, 111, 114,
-  0, 8, 17, 8, 10, 0, 130, 97, 116, 111, 114, 0, 23, 15, 15, 24, 17, 0, 130,
-  112, 116, 114, 0, 70, 231, 10, 18, 240, 10, 0, 4, 9, 8, 21, 0, 128, 111, 114,
-  0, 68, 247, 10, 6, 1, 11, 0, 21, 8, 19, 18, 0, 130, 116, 111, 114, 0, 68, 8,
-  11, 24, 17, 11, 0, 9, 8, 21, 0, 130, 116, 111, 114, 0, 21, 23, 22, 17, 18, 6,
-  0, 130, 116, 111, 114, 0, 12, 15, 4, 12, 21, 8, 22, 0, 128, 101, 114, 0, 68,
-  54, 11, 8, 79, 11, 22, 130, 11, 24, 160, 11, 0, 86, 61, 11, 28, 70, 11, 0, 15,
-  6, 44, 0, 130, 97, 115, 115, 0, 26, 15, 4, 0, 130, 97, 121, 115, 0, 70, 92,
-  11, 12, 103, 11, 15, 113, 11, 22, 120, 11, 0, 8, 7, 17, 12, 0, 131, 105, 99,
-  101, 115, 0, 6, 12, 7, 17, 12, 0, 130, 101, 115, 0, 4, 9, 0, 129, 115, 101, 0,
-  6, 6, 24, 22, 0, 130, 101, 115, 115, 0, 8, 0, 70, 139, 11, 17, 149, 11, 0, 6,
-  18, 21, 19, 0, 131, 101, 115, 115, 0, 22, 24, 5, 0, 131, 105, 110, 101, 115,
-  115, 0, 86, 167, 11, 23, 182, 11, 0, 17, 8, 6, 17, 18, 6, 0, 133, 115, 101,
-  110, 115, 117, 115, 0, 4, 22, 0, 131, 116, 97, 116, 117, 115, 0, 116, 238, 11,
-  4, 251, 11, 6, 4, 12, 8, 15, 12, 10, 107, 12, 11, 117, 12, 12, 139, 12, 15,
-  153, 12, 16, 213, 12, 17, 225, 12, 18, 70, 14, 19, 109, 14, 21, 128, 14, 22,
-  139, 14, 24, 183, 14, 0, 17, 8, 22, 18, 7, 0, 132, 101, 115, 110, 39, 116, 0,
-  12, 26, 4, 0, 130, 97, 105, 116, 0, 13, 8, 5, 18, 0, 131, 106, 101, 99, 116,
-  0, 70, 28, 12, 17, 38, 12, 22, 80, 12, 28, 95, 12, 0, 19, 27, 8, 44, 0, 130,
-  101, 99, 116, 0, 80, 45, 12, 18, 71, 12, 0, 72, 52, 12, 28, 60, 12, 0, 15, 8,
-  0, 130, 101, 110, 116, 0, 18, 15, 19, 8, 7, 0, 130, 101, 110, 116, 0, 19, 16,
-  18, 6, 0, 128, 110, 116, 0, 28, 21, 24, 8, 20, 0, 134, 117, 101, 114, 121,
-  115, 101, 116, 0, 22, 21, 8, 24, 20, 0, 131, 121, 115, 101, 116, 0, 11, 24, 4,
-  6, 0, 130, 103, 104, 116, 0, 71, 124, 12, 10, 131, 12, 0, 12, 26, 0, 129, 116,
-  104, 0, 17, 8, 15, 0, 129, 116, 104, 0, 19, 21, 6, 22, 8, 19, 28, 23, 0, 130,
-  105, 112, 116, 0, 68, 163, 12, 8, 174, 12, 24, 183, 12, 0, 24, 9, 8, 7, 0,
-  131, 97, 117, 108, 116, 0, 24, 7, 18, 16, 0, 130, 108, 101, 0, 68, 190, 12, 9,
-  202, 12, 0, 8, 9, 7, 0, 133, 101, 102, 97, 117, 108, 116, 0, 4, 8, 7, 0, 132,
-  102, 97, 117, 108, 116, 0, 4, 23, 21, 18, 19, 16, 12, 0, 129, 110, 116, 0, 68,
-  247, 12, 8, 35, 13, 12, 254, 13, 16, 11, 14, 17, 39, 14, 18, 52, 14, 22, 62,
-  14, 0, 80, 1, 13, 21, 13, 13, 22, 23, 13, 0, 28, 18, 15, 19, 8, 7, 0, 130,
-  101, 110, 116, 0, 4, 19, 19, 4, 0, 130, 101, 110, 116, 0, 23, 17, 18, 6, 0,
-  132, 115, 116, 97, 110, 116, 0, 76, 51, 13, 16, 65, 13, 17, 160, 13, 21, 172,
-  13, 25, 244, 13, 0, 6, 8, 9, 9, 8, 0, 133, 105, 99, 105, 101, 110, 116, 0, 74,
-  81, 13, 15, 93, 13, 18, 104, 13, 21, 137, 13, 23, 149, 13, 0, 24, 21, 4, 0,
-  133, 103, 117, 109, 101, 110, 116, 0, 19, 16, 12, 0, 131, 101, 109, 101, 110,
-  116, 0, 81, 111, 13, 21, 125, 13, 0, 21, 12, 25, 17, 8, 0, 133, 111, 110, 109,
-  101, 110, 116, 0, 12, 25, 17, 8, 0, 131, 110, 109, 101, 110, 116, 0, 8, 25,
-  18, 10, 0, 131, 110, 109, 101, 110, 116, 0, 4, 23, 22, 0, 131, 101, 109, 101,
-  110, 116, 0, 19, 16, 18, 6, 0, 131, 111, 110, 101, 110, 116, 0, 68, 185, 13,
-  8, 196, 13, 9, 208, 13, 21, 219, 13, 0, 19, 4, 0, 132, 112, 97, 114, 101, 110,
-  116, 0, 9, 12, 7, 0, 132, 102, 101, 114, 101, 110, 116, 0, 9, 12, 7, 0, 131,
-  101, 114, 101, 110, 116, 0, 4, 19, 0, 68, 229, 13, 19, 237, 13, 0, 133, 112,
-  97, 114, 101, 110, 116, 0, 4, 0, 131, 101, 110, 116, 0, 8, 15, 8, 21, 0, 130,
-  97, 110, 116, 0, 18, 19, 17, 8, 0, 132, 100, 112, 111, 105, 110, 116, 0, 8,
-  24, 0, 70, 21, 14, 10, 30, 14, 0, 18, 7, 0, 131, 109, 101, 110, 116, 0, 21, 4,
-  0, 131, 109, 101, 110, 116, 0, 8, 18, 19, 16, 18, 6, 0, 131, 110, 101, 110,
-  116, 0, 19, 7, 17, 8, 0, 129, 105, 110, 116, 0, 18, 6, 0, 130, 110, 115, 116,
-  0, 85, 77, 14, 22, 100, 14, 0, 19, 0, 80, 86, 14, 27, 93, 14, 0, 12, 0, 130,
-  111, 114, 116, 0, 8, 0, 130, 111, 114, 116, 0, 16, 15, 4, 0, 130, 111, 115,
-  116, 0, 12, 21, 6, 22, 19, 8, 28, 23, 0, 135, 112, 101, 115, 99, 114, 105,
-  112, 116, 0, 19, 18, 16, 12, 0, 131, 112, 111, 114, 116, 0, 72, 146, 14, 16,
-  173, 14, 0, 72, 153, 14, 10, 164, 14, 0, 26, 12, 25, 0, 132, 101, 119, 115,
-  101, 116, 0, 24, 22, 0, 130, 103, 101, 115, 116, 0, 18, 15, 4, 0, 131, 109,
-  111, 115, 116, 0, 70, 193, 14, 18, 204, 14, 19, 217, 14, 0, 8, 6, 27, 8, 0,
-  132, 101, 99, 117, 116, 0, 14, 8, 11, 6, 44, 0, 131, 99, 107, 111, 117, 116,
-  0, 23, 17, 12, 0, 131, 112, 117, 116, 0, 12, 8, 25, 8, 21, 0, 130, 105, 101,
-  119, 0, 70, 6, 15, 8, 54, 15, 11, 64, 15, 15, 82, 15, 18, 151, 15, 21, 182,
-  15, 22, 47, 16, 23, 56, 16, 0, 72, 13, 15, 17, 41, 15, 0, 71, 20, 15, 24, 31,
-  15, 0, 17, 8, 19, 8, 7, 0, 129, 110, 99, 121, 0, 20, 8, 21, 9, 0, 129, 110,
-  99, 121, 0, 7, 17, 8, 19, 8, 7, 0, 130, 101, 110, 99, 121, 0, 23, 9, 4, 22, 0,
-  130, 101, 116, 121, 0, 6, 21, 4, 21, 12, 8, 11, 0, 135, 105, 101, 114, 97,
-  114, 99, 104, 121, 0, 68, 89, 15, 15, 121, 15, 0, 69, 99, 15, 8, 108, 15, 17,
-  114, 15, 0, 18, 21, 19, 0, 129, 98, 108, 121, 0, 21, 0, 128, 108, 121, 0, 12,
-  9, 0, 128, 108, 121, 0, 68, 128, 15, 8, 141, 15, 0, 23, 24, 6, 4, 0, 133, 116,
-  117, 97, 108, 108, 121, 0, 4, 21, 0, 132, 101, 97, 108, 108, 121, 0, 21, 23,
-  0, 70, 161, 15, 12, 171, 15, 0, 8, 21, 12, 7, 0, 130, 111, 114, 121, 0, 22,
-  18, 19, 8, 21, 0, 130, 111, 114, 121, 0, 68, 195, 15, 8, 10, 16, 18, 19, 16,
-  23, 34, 16, 0, 69, 208, 15, 18, 217, 15, 21, 231, 15, 22, 237, 15, 0, 12, 15,
-  0, 130, 114, 97, 114, 121, 0, 17, 12, 23, 6, 12, 7, 0, 132, 111, 110, 97, 114,
-  121, 0, 21, 4, 0, 129, 121, 0, 8, 6, 0, 70, 247, 15, 8, 2, 16, 0, 8, 17, 0,
-  133, 101, 115, 115, 97, 114, 121, 0, 17, 0, 130, 115, 97, 114, 121, 0, 19, 18,
-  21, 19, 0, 128, 116, 121, 0, 12, 23, 22, 18, 19, 8, 21, 0, 132, 105, 116, 111,
-  114, 121, 0, 18, 6, 8, 21, 12, 7, 0, 131, 116, 111, 114, 121, 0, 4, 26, 15, 4,
-  0, 129, 121, 115, 0, 21, 19, 8, 18, 21, 19, 0, 132, 112, 101, 114, 116, 121,
-  0};
+static const uint8_t autocorrection_data[3999] PROGMEM = {31, 255, 249, 127, 5,
+  51, 0, 162, 1, 25, 2, 83, 3, 88, 4, 240, 4, 107, 5, 164, 5, 204, 5, 166, 6,
+  235, 6, 73, 7, 140, 7, 216, 7, 203, 8, 230, 8, 189, 9, 214, 10, 78, 11, 128,
+  11, 197, 11, 210, 11, 217, 11, 31, 14, 136, 127, 0, 80, 0, 89, 0, 128, 0, 136,
+  0, 201, 0, 253, 0, 4, 1, 37, 1, 44, 1, 70, 1, 118, 1, 156, 1, 46, 84, 51, 51,
+  39, 68, 194, 18, 15, 63, 4, 64, 16, 0, 100, 0, 110, 0, 120, 0, 46, 76, 110,
+  67, 96, 83, 100, 196, 198, 14, 76, 108, 142, 67, 96, 83, 100, 199, 195, 14,
+  51, 32, 43, 75, 56, 197, 184, 12, 35, 51, 40, 46, 45, 195, 24, 14, 63, 64, 80,
+  64, 0, 149, 0, 170, 0, 176, 0, 182, 0, 46, 81, 51, 63, 128, 1, 0, 0, 161, 0,
+  165, 0, 76, 194, 73, 14, 39, 44, 195, 73, 14, 50, 46, 51, 194, 238, 12, 76,
+  50, 51, 195, 237, 12, 63, 1, 0, 0, 1, 191, 0, 196, 0, 50, 88, 193, 119, 13,
+  32, 50, 194, 118, 13, 63, 1, 128, 0, 0, 210, 0, 231, 0, 81, 127, 16, 0, 2, 0,
+  220, 0, 225, 0, 77, 83, 196, 28, 13, 100, 77, 83, 197, 28, 13, 32, 81, 127, 1,
+  0, 2, 0, 242, 0, 247, 0, 141, 51, 194, 64, 13, 100, 77, 83, 195, 64, 13, 52,
+  72, 49, 36, 196, 238, 14, 63, 64, 0, 18, 0, 15, 1, 23, 1, 29, 1, 52, 68, 44,
+  45, 51, 195, 56, 13, 32, 81, 88, 193, 216, 12, 38, 44, 36, 77, 83, 197, 41,
+  13, 56, 45, 39, 34, 193, 150, 15, 51, 63, 0, 1, 2, 0, 54, 1, 62, 1, 49, 33,
+  52, 83, 36, 197, 168, 14, 40, 52, 33, 51, 36, 195, 170, 14, 51, 39, 95, 16,
+  64, 0, 0, 81, 1, 108, 1, 77, 83, 63, 4, 1, 0, 0, 92, 1, 100, 1, 32, 83, 72,
+  46, 45, 197, 45, 14, 32, 66, 83, 46, 77, 196, 46, 14, 49, 40, 57, 0, 51, 78,
+  77, 193, 56, 14, 32, 95, 0, 9, 0, 0, 128, 1, 148, 1, 107, 63, 3, 0, 0, 0, 138,
+  1, 143, 1, 65, 68, 192, 15, 15, 43, 36, 194, 13, 15, 72, 64, 97, 75, 36, 197,
+  3, 15, 40, 64, 83, 194, 85, 13, 31, 17, 64, 18, 0, 177, 1, 186, 1, 232, 1,
+  253, 1, 17, 2, 45, 35, 54, 40, 83, 39, 193, 105, 14, 63, 5, 0, 0, 0, 195, 1,
+  202, 1, 34, 84, 114, 36, 196, 205, 14, 63, 5, 0, 16, 0, 213, 1, 219, 1, 226,
+  1, 82, 84, 68, 194, 207, 14, 32, 84, 114, 36, 196, 206, 14, 32, 50, 68, 195,
+  206, 14, 46, 63, 16, 8, 0, 0, 242, 1, 248, 1, 43, 64, 77, 195, 68, 14, 36, 77,
+  192, 70, 14, 32, 95, 4, 32, 0, 0, 7, 2, 12, 2, 77, 39, 194, 114, 14, 39, 34,
+  193, 115, 14, 50, 45, 36, 82, 50, 195, 135, 13, 31, 129, 73, 0, 0, 40, 2, 98,
+  2, 135, 2, 143, 2, 149, 2, 63, 4, 8, 16, 0, 51, 2, 59, 2, 92, 2, 71, 68, 104,
+  141, 70, 195, 126, 14, 95, 2, 8, 16, 0, 70, 2, 76, 2, 83, 2, 32, 66, 74, 195,
+  99, 14, 33, 32, 74, 2, 193, 102, 14, 34, 52, 43, 32, 83, 68, 198, 181, 14, 71,
+  38, 51, 194, 89, 13, 63, 16, 96, 0, 0, 109, 2, 122, 2, 128, 2, 95, 0, 5, 0, 0,
+  118, 2, 79, 2, 101, 194, 138, 14, 32, 70, 36, 195, 32, 15, 46, 50, 36, 77,
+  195, 64, 14, 36, 43, 72, 77, 70, 197, 123, 14, 32, 68, 49, 194, 236, 13, 63,
+  0, 56, 20, 0, 164, 2, 172, 2, 236, 2, 73, 3, 78, 3, 43, 36, 70, 52, 68, 194,
+  163, 14, 63, 0, 145, 0, 0, 183, 2, 188, 2, 193, 2, 83, 58, 194, 81, 13, 51,
+  40, 193, 86, 13, 63, 0, 104, 0, 0, 204, 2, 210, 2, 216, 2, 40, 68, 49, 195,
+  212, 13, 36, 77, 83, 195, 35, 13, 95, 16, 32, 0, 0, 225, 2, 231, 2, 45, 77,
+  51, 195, 36, 13, 36, 83, 192, 71, 13, 63, 36, 1, 12, 0, 251, 2, 3, 3, 28, 3,
+  33, 3, 43, 3, 36, 45, 82, 52, 82, 197, 128, 13, 40, 70, 63, 0, 0, 18, 0, 14,
+  3, 22, 3, 32, 83, 72, 46, 45, 197, 37, 14, 81, 32, 94, 19, 113, 1, 37, 38,
+  194, 130, 14, 51, 81, 116, 34, 46, 83, 49, 194, 162, 13, 63, 0, 65, 4, 0, 54,
+  3, 59, 3, 67, 3, 32, 77, 194, 60, 14, 81, 43, 43, 36, 81, 197, 205, 13, 32,
+  77, 51, 196, 68, 13, 45, 51, 194, 242, 12, 35, 75, 193, 117, 15, 31, 49, 65,
+  0, 1, 100, 3, 108, 3, 232, 3, 240, 3, 51, 4, 80, 4, 51, 64, 33, 82, 36, 193,
+  229, 14, 63, 35, 128, 0, 0, 121, 3, 128, 3, 147, 3, 154, 3, 37, 52, 75, 51,
+  196, 75, 13, 52, 70, 63, 80, 0, 0, 0, 139, 3, 143, 3, 81, 193, 228, 13, 49,
+  192, 229, 13, 84, 64, 43, 83, 195, 76, 13, 63, 16, 8, 2, 0, 165, 3, 202, 3,
+  223, 3, 95, 0, 32, 2, 0, 174, 3, 194, 3, 67, 127, 16, 32, 0, 0, 184, 3, 189,
+  3, 66, 56, 193, 211, 12, 34, 56, 194, 210, 12, 98, 32, 83, 68, 67, 198, 120,
+  15, 46, 88, 44, 63, 1, 32, 0, 0, 214, 3, 218, 3, 94, 13, 243, 0, 36, 94, 19,
+  244, 0, 68, 64, 98, 83, 36, 67, 196, 122, 15, 36, 32, 52, 75, 51, 197, 74, 13,
+  63, 36, 0, 2, 0, 251, 3, 5, 4, 28, 4, 51, 40, 45, 78, 32, 49, 88, 196, 178,
+  12, 63, 48, 0, 0, 0, 14, 4, 21, 4, 49, 36, 77, 83, 196, 21, 13, 49, 68, 109,
+  83, 195, 22, 13, 36, 66, 127, 0, 64, 8, 0, 39, 4, 45, 4, 83, 49, 56, 195, 161,
+  12, 49, 46, 56, 194, 162, 12, 63, 4, 0, 20, 0, 62, 4, 67, 4, 74, 4, 84, 62, 4,
+  17, 1, 36, 77, 91, 19, 196, 112, 13, 43, 33, 36, 194, 14, 15, 32, 45, 44, 40,
+  66, 196, 146, 15, 31, 32, 40, 128, 0, 101, 4, 111, 4, 117, 4, 168, 4, 37, 36,
+  34, 40, 68, 109, 83, 197, 61, 13, 36, 76, 62, 13, 218, 3, 63, 8, 128, 32, 0,
+  128, 4, 135, 4, 142, 4, 47, 46, 77, 51, 193, 17, 13, 46, 72, 109, 83, 196, 14,
+  13, 40, 81, 127, 0, 96, 0, 0, 153, 4, 161, 4, 46, 44, 36, 77, 83, 197, 48, 13,
+  44, 36, 77, 83, 195, 49, 13, 31, 20, 128, 0, 0, 179, 4, 214, 4, 222, 4, 63,
+  16, 128, 0, 0, 188, 4, 206, 4, 63, 4, 0, 8, 0, 197, 4, 202, 4, 52, 51, 196,
+  232, 12, 47, 193, 6, 13, 36, 83, 40, 46, 45, 197, 15, 14, 47, 51, 40, 46, 45,
+  197, 14, 14, 49, 95, 0, 64, 8, 0, 232, 4, 236, 4, 115, 194, 252, 12, 62, 26,
+  233, 4, 31, 1, 73, 18, 0, 1, 5, 28, 5, 49, 5, 55, 5, 62, 5, 82, 5, 63, 0, 9,
+  4, 0, 12, 5, 18, 5, 23, 5, 43, 50, 36, 195, 219, 14, 68, 82, 193, 230, 14, 75,
+  36, 194, 219, 14, 63, 0, 32, 8, 0, 37, 5, 43, 5, 64, 75, 88, 192, 198, 12, 43,
+  36, 81, 195, 191, 13, 32, 82, 68, 195, 218, 14, 54, 32, 49, 67, 195, 104, 15,
+  63, 16, 64, 0, 0, 71, 5, 78, 5, 80, 52, 68, 126, 2, 185, 3, 62, 12, 83, 0, 63,
+  4, 32, 0, 0, 91, 5, 99, 5, 45, 51, 40, 46, 45, 197, 30, 14, 66, 40, 83, 46,
+  77, 195, 48, 14, 31, 17, 72, 16, 0, 122, 5, 132, 5, 141, 5, 148, 5, 155, 5,
+  52, 81, 32, 77, 51, 36, 68, 199, 52, 15, 45, 68, 81, 51, 46, 81, 194, 161, 13,
+  46, 64, 33, 75, 194, 92, 14, 53, 68, 113, 158, 12, 162, 4, 32, 49, 64, 83, 68,
+  68, 194, 56, 15, 31, 17, 0, 0, 0, 173, 5, 181, 5, 45, 43, 35, 36, 81, 195,
+  217, 13, 40, 63, 64, 0, 2, 0, 191, 5, 196, 5, 51, 39, 193, 90, 13, 32, 81, 66,
+  39, 88, 199, 201, 12, 31, 1, 48, 0, 0, 215, 5, 221, 5, 25, 6, 44, 38, 36, 195,
+  42, 15, 63, 0, 192, 0, 0, 230, 5, 236, 5, 79, 81, 83, 195, 251, 12, 63, 0, 72,
+  2, 0, 247, 5, 13, 6, 21, 6, 63, 16, 16, 0, 0, 0, 6, 7, 6, 76, 36, 83, 45, 193,
+  71, 13, 36, 77, 83, 195, 55, 13, 81, 51, 32, 44, 62, 19, 4, 6, 94, 14, 232, 4,
+  63, 40, 1, 12, 0, 40, 6, 62, 6, 76, 6, 97, 6, 105, 6, 63, 16, 1, 0, 0, 49, 6,
+  55, 6, 66, 36, 50, 195, 149, 13, 66, 104, 68, 114, 194, 151, 13, 49, 64, 82,
+  83, 81, 116, 34, 52, 51, 49, 36, 195, 233, 14, 51, 32, 63, 0, 9, 0, 0, 87, 6,
+  94, 6, 43, 40, 89, 4, 197, 142, 14, 193, 88, 14, 51, 77, 32, 66, 68, 195, 79,
+  15, 63, 16, 128, 0, 0, 114, 6, 161, 6, 95, 32, 0, 2, 0, 123, 6, 129, 6, 64,
+  66, 68, 195, 93, 15, 63, 33, 0, 0, 0, 138, 6, 144, 6, 83, 78, 81, 199, 158,
+  13, 34, 63, 17, 0, 0, 0, 154, 6, 158, 6, 68, 194, 95, 15, 193, 95, 15, 52, 51,
+  195, 222, 12, 31, 17, 65, 0, 0, 179, 6, 186, 6, 193, 6, 215, 6, 44, 33, 32,
+  67, 193, 156, 15, 45, 70, 39, 51, 193, 106, 14, 63, 3, 0, 0, 0, 202, 6, 209,
+  6, 82, 72, 78, 45, 195, 9, 14, 32, 81, 88, 194, 173, 12, 46, 63, 0, 0, 20, 0,
+  225, 6, 231, 6, 36, 82, 122, 196, 145, 13, 47, 193, 240, 13, 31, 17, 65, 0, 0,
+  248, 6, 2, 7, 9, 7, 65, 7, 40, 45, 83, 100, 141, 66, 36, 193, 79, 15, 50, 32,
+  70, 36, 194, 37, 15, 63, 72, 0, 0, 0, 18, 7, 44, 7, 63, 8, 8, 0, 0, 27, 7, 36,
+  7, 43, 36, 86, 49, 32, 68, 194, 255, 14, 36, 86, 32, 49, 68, 197, 251, 14, 49,
+  32, 95, 0, 1, 8, 0, 55, 7, 59, 7, 62, 19, 102, 5, 78, 72, 45, 194, 56, 14, 35,
+  52, 36, 43, 83, 194, 15, 15, 31, 17, 0, 16, 0, 84, 7, 107, 7, 132, 7, 44, 36,
+  82, 127, 1, 128, 0, 0, 96, 7, 102, 7, 143, 66, 36, 195, 88, 15, 34, 62, 0,
+  154, 6, 34, 63, 20, 0, 0, 0, 117, 7, 125, 7, 36, 50, 32, 81, 88, 197, 166, 12,
+  50, 32, 81, 88, 194, 168, 12, 43, 43, 51, 47, 49, 194, 154, 13, 31, 6, 128,
+  32, 0, 153, 7, 160, 7, 184, 7, 192, 7, 36, 73, 2, 51, 195, 107, 13, 34, 63, 1,
+  0, 16, 0, 170, 7, 178, 7, 82, 82, 40, 78, 45, 195, 56, 14, 49, 36, 67, 193,
+  128, 15, 36, 81, 96, 78, 62, 19, 39, 3, 63, 16, 0, 32, 0, 201, 7, 208, 7, 49,
+  40, 35, 36, 194, 63, 15, 36, 49, 40, 35, 36, 197, 61, 15, 31, 17, 64, 6, 0,
+  231, 7, 16, 8, 77, 8, 85, 8, 196, 8, 63, 4, 0, 2, 0, 240, 7, 247, 7, 64, 74,
+  6, 36, 195, 47, 15, 95, 1, 0, 8, 0, 0, 8, 7, 8, 76, 51, 36, 81, 194, 200, 13,
+  40, 34, 52, 32, 43, 81, 194, 232, 13, 49, 63, 32, 16, 0, 0, 26, 8, 52, 8, 46,
+  95, 0, 16, 2, 0, 36, 8, 44, 8, 49, 32, 77, 34, 36, 197, 77, 15, 32, 76, 45,
+  34, 36, 196, 78, 15, 63, 0, 1, 4, 0, 61, 8, 69, 8, 82, 40, 82, 46, 45, 195,
+  55, 14, 40, 82, 40, 78, 45, 197, 53, 14, 40, 51, 45, 36, 81, 195, 186, 13, 63,
+  1, 65, 0, 0, 96, 8, 105, 8, 128, 8, 76, 32, 68, 51, 36, 81, 199, 196, 13, 63,
+  0, 0, 40, 0, 114, 8, 119, 8, 45, 58, 194, 71, 13, 40, 75, 36, 67, 38, 36, 194,
+  49, 15, 63, 22, 145, 0, 0, 145, 8, 164, 8, 171, 8, 178, 8, 184, 8, 190, 8, 95,
+  17, 0, 0, 0, 154, 8, 159, 8, 75, 88, 193, 197, 12, 107, 76, 194, 78, 14, 66,
+  100, 50, 50, 195, 137, 13, 47, 49, 83, 56, 196, 150, 12, 44, 82, 36, 195, 223,
+  14, 50, 40, 68, 194, 224, 14, 68, 113, 152, 192, 157, 12, 52, 68, 35, 46, 195,
+  250, 13, 31, 16, 0, 16, 0, 212, 8, 221, 8, 52, 49, 56, 50, 36, 83, 198, 93,
+  13, 36, 49, 50, 56, 36, 83, 195, 96, 13, 31, 17, 0, 0, 0, 239, 8, 246, 8, 36,
+  43, 75, 56, 196, 191, 12, 63, 101, 136, 56, 0, 13, 9, 27, 9, 34, 9, 68, 9, 92,
+  9, 100, 9, 159, 9, 177, 9, 183, 9, 63, 2, 8, 0, 0, 22, 9, 39, 5, 82, 36, 195,
+  228, 14, 40, 68, 117, 36, 195, 149, 14, 95, 17, 0, 0, 0, 43, 9, 61, 9, 66, 95,
+  0, 64, 8, 0, 53, 9, 57, 9, 126, 19, 39, 3, 49, 192, 163, 13, 49, 36, 66, 100,
+  193, 80, 15, 63, 0, 1, 4, 0, 77, 9, 85, 9, 50, 36, 83, 36, 81, 195, 201, 13,
+  40, 83, 36, 81, 196, 180, 13, 68, 117, 36, 45, 83, 194, 70, 13, 63, 0, 65, 4,
+  0, 111, 9, 120, 9, 154, 9, 51, 40, 51, 40, 46, 45, 198, 22, 14, 95, 0, 32, 4,
+  0, 129, 9, 134, 9, 50, 36, 196, 211, 14, 63, 0, 1, 8, 0, 143, 9, 147, 9, 94,
+  19, 45, 4, 72, 110, 49, 56, 196, 160, 12, 78, 62, 13, 130, 9, 63, 0, 0, 18, 0,
+  168, 9, 173, 9, 52, 45, 194, 5, 14, 45, 192, 6, 14, 51, 49, 45, 195, 4, 14,
+  36, 40, 54, 194, 218, 12, 31, 149, 1, 90, 0, 212, 9, 232, 9, 10, 10, 72, 10,
+  77, 10, 108, 10, 118, 10, 146, 10, 193, 10, 63, 32, 0, 8, 0, 221, 9, 227, 9,
+  51, 36, 88, 194, 156, 12, 84, 50, 195, 122, 13, 39, 95, 16, 16, 0, 0, 242, 9,
+  5, 10, 127, 9, 0, 0, 0, 251, 9, 255, 9, 44, 193, 153, 15, 52, 36, 43, 193, 15,
+  15, 36, 64, 194, 152, 15, 63, 16, 128, 6, 0, 23, 10, 30, 10, 38, 10, 62, 8,
+  50, 40, 78, 45, 196, 54, 14, 36, 81, 96, 83, 68, 196, 175, 14, 63, 1, 1, 32,
+  0, 49, 10, 58, 10, 66, 10, 72, 43, 40, 89, 4, 49, 198, 172, 13, 32, 75, 72,
+  89, 30, 17, 144, 3, 34, 40, 68, 194, 84, 15, 46, 62, 20, 78, 3, 63, 0, 48, 0,
+  0, 86, 10, 94, 10, 72, 75, 40, 64, 113, 194, 237, 13, 70, 36, 95, 8, 8, 0, 0,
+  105, 10, 2, 10, 195, 141, 15, 40, 32, 75, 72, 89, 4, 49, 199, 170, 13, 63, 1,
+  1, 2, 0, 129, 10, 134, 10, 140, 10, 51, 94, 12, 7, 6, 49, 45, 38, 195, 118,
+  14, 40, 38, 45, 193, 127, 14, 63, 70, 0, 0, 0, 157, 10, 180, 10, 187, 10, 50,
+  34, 95, 0, 1, 2, 0, 168, 10, 174, 10, 81, 33, 36, 195, 99, 15, 40, 47, 36,
+  193, 101, 15, 34, 50, 36, 82, 194, 137, 13, 36, 82, 51, 194, 246, 12, 63, 0,
+  1, 8, 0, 202, 10, 208, 10, 83, 39, 94, 2, 14, 2, 40, 34, 39, 195, 109, 14, 31,
+  144, 64, 0, 1, 227, 10, 253, 10, 26, 11, 49, 11, 63, 1, 16, 0, 0, 236, 10,
+  245, 10, 44, 47, 43, 32, 83, 68, 198, 188, 14, 47, 32, 75, 83, 36, 195, 190,
+  14, 63, 0, 33, 2, 0, 8, 11, 13, 11, 18, 11, 42, 13, 193, 96, 14, 40, 38, 194,
+  126, 14, 36, 82, 46, 43, 35, 194, 110, 15, 63, 72, 0, 0, 0, 35, 11, 40, 11,
+  56, 64, 193, 215, 12, 39, 36, 83, 39, 68, 81, 197, 222, 13, 63, 16, 128, 0, 0,
+  58, 11, 68, 11, 79, 50, 66, 81, 40, 47, 51, 199, 0, 13, 36, 82, 34, 81, 47,
+  40, 51, 194, 5, 13, 31, 8, 32, 0, 0, 87, 11, 97, 11, 45, 36, 69, 72, 77, 100,
+  67, 199, 132, 15, 63, 8, 4, 1, 0, 108, 11, 116, 11, 122, 11, 37, 72, 77, 100,
+  67, 196, 134, 15, 14, 54, 45, 194, 255, 13, 40, 52, 36, 195, 158, 14, 31, 1,
+  1, 2, 0, 139, 11, 148, 11, 188, 11, 40, 49, 32, 65, 75, 36, 197, 11, 15, 63,
+  16, 0, 74, 0, 161, 11, 168, 11, 175, 11, 181, 11, 54, 50, 51, 68, 193, 104,
+  13, 52, 51, 32, 43, 195, 83, 14, 52, 32, 43, 195, 82, 14, 36, 36, 50, 51, 196,
+  101, 13, 32, 72, 32, 65, 75, 36, 198, 10, 15, 31, 0, 65, 0, 0, 206, 11, 73,
+  10, 62, 3, 188, 6, 4, 40, 43, 35, 195, 115, 15, 31, 221, 16, 14, 0, 242, 11,
+  5, 12, 28, 12, 51, 12, 59, 12, 78, 12, 85, 12, 92, 12, 102, 12, 108, 12, 63,
+  0, 40, 0, 0, 251, 11, 1, 12, 78, 115, 58, 195, 9, 13, 62, 3, 83, 0, 63, 128,
+  8, 0, 0, 14, 12, 22, 12, 68, 106, 142, 52, 51, 195, 226, 12, 82, 32, 82, 194,
+  141, 13, 63, 1, 2, 0, 0, 37, 12, 44, 12, 73, 13, 38, 46, 196, 244, 13, 0, 38,
+  45, 46, 194, 246, 13, 55, 79, 98, 36, 51, 194, 108, 13, 63, 0, 64, 16, 0, 68,
+  12, 72, 12, 94, 8, 141, 10, 64, 102, 36, 195, 23, 15, 51, 36, 81, 36, 196,
+  245, 14, 36, 70, 36, 81, 194, 28, 15, 37, 36, 49, 36, 77, 66, 36, 198, 68, 15,
+  43, 36, 69, 194, 134, 14, 63, 128, 64, 16, 0, 119, 12, 141, 12, 145, 12, 95,
+  16, 1, 0, 0, 128, 12, 136, 12, 90, 51, 71, 100, 154, 196, 158, 15, 100, 49,
+  194, 166, 13, 94, 19, 84, 0, 49, 36, 194, 154, 14, 112, 101, 114, 116, 121, 0,
+  101, 116, 121, 0, 105, 116, 111, 114, 121, 0, 101, 115, 115, 97, 114, 121, 0,
+  114, 97, 114, 121, 0, 111, 110, 97, 114, 121, 0, 116, 117, 97, 108, 108, 121,
+  0, 101, 97, 108, 108, 121, 0, 98, 108, 121, 0, 105, 101, 114, 97, 114, 99,
+  104, 121, 0, 101, 110, 99, 121, 0, 97, 121, 0, 105, 101, 119, 0, 112, 117,
+  116, 0, 99, 107, 111, 117, 116, 0, 101, 99, 117, 116, 0, 109, 111, 115, 116,
+  0, 110, 115, 116, 0, 103, 101, 115, 116, 0, 112, 111, 114, 116, 0, 112, 101,
+  115, 99, 114, 105, 112, 116, 0, 32, 108, 111, 116, 0, 100, 112, 111, 105, 110,
+  116, 0, 102, 101, 114, 101, 110, 116, 0, 112, 97, 114, 101, 110, 116, 0, 111,
+  110, 101, 110, 116, 0, 103, 117, 109, 101, 110, 116, 0, 111, 110, 109, 101,
+  110, 116, 0, 101, 109, 101, 110, 116, 0, 105, 99, 105, 101, 110, 116, 0, 115,
+  116, 97, 110, 116, 0, 101, 102, 97, 117, 108, 116, 0, 109, 105, 116, 0, 97,
+  105, 116, 0, 103, 104, 116, 0, 117, 101, 114, 121, 115, 101, 116, 0, 101, 119,
+  115, 101, 116, 0, 106, 101, 99, 116, 0, 101, 115, 110, 39, 116, 0, 97, 121,
+  115, 0, 116, 97, 116, 117, 115, 0, 115, 101, 110, 115, 117, 115, 0, 105, 110,
+  101, 115, 115, 0, 97, 115, 115, 0, 115, 101, 115, 0, 105, 99, 101, 115, 0,
+  112, 116, 114, 0, 116, 101, 114, 97, 116, 111, 114, 0, 101, 105, 114, 0, 101,
+  114, 105, 97, 108, 105, 122, 101, 114, 0, 105, 115, 116, 101, 114, 0, 110,
+  116, 101, 114, 0, 108, 116, 101, 114, 0, 97, 114, 97, 109, 101, 116, 101, 114,
+  0, 114, 111, 108, 108, 101, 114, 0, 105, 108, 101, 114, 0, 100, 108, 101, 114,
+  0, 101, 116, 104, 101, 114, 0, 103, 101, 114, 0, 108, 97, 114, 0, 101, 97,
+  114, 0, 107, 117, 112, 0, 106, 97, 110, 103, 111, 0, 101, 117, 100, 111, 0,
+  110, 111, 119, 110, 0, 116, 117, 114, 110, 0, 105, 115, 111, 110, 0, 99, 101,
+  112, 116, 105, 111, 110, 0, 101, 116, 105, 116, 105, 111, 110, 0, 110, 99,
+  116, 105, 111, 110, 0, 117, 114, 97, 116, 105, 111, 110, 0, 105, 99, 97, 116,
+  105, 111, 110, 0, 105, 115, 115, 105, 111, 110, 0, 97, 105, 110, 0, 115, 101,
+  110, 0, 108, 101, 97, 110, 0, 105, 116, 104, 109, 0, 108, 101, 109, 0, 114,
+  116, 117, 97, 108, 0, 105, 97, 108, 0, 98, 97, 108, 0, 110, 107, 0, 108, 98,
+  97, 99, 107, 0, 100, 116, 104, 0, 105, 116, 99, 104, 0, 110, 99, 104, 0, 114,
+  105, 110, 103, 0, 101, 105, 108, 105, 110, 103, 0, 102, 105, 103, 0, 101, 108,
+  102, 0, 105, 101, 102, 0, 105, 97, 108, 105, 122, 101, 0, 101, 105, 118, 101,
+  0, 114, 117, 101, 0, 105, 113, 117, 101, 0, 97, 103, 117, 101, 0, 114, 105,
+  98, 117, 116, 101, 0, 97, 114, 97, 116, 101, 0, 99, 117, 108, 97, 116, 101, 0,
+  109, 112, 108, 97, 116, 101, 0, 99, 111, 109, 109, 111, 100, 97, 116, 101, 0,
+  99, 97, 117, 115, 101, 0, 115, 112, 111, 110, 115, 101, 0, 97, 108, 115, 101,
+  0, 109, 105, 115, 101, 0, 98, 97, 115, 101, 0, 116, 117, 114, 101, 0, 99, 113,
+  117, 105, 114, 101, 0, 116, 104, 101, 114, 101, 0, 100, 108, 101, 119, 97,
+  114, 101, 0, 105, 108, 97, 98, 108, 101, 0, 97, 114, 105, 97, 98, 108, 101, 0,
+  32, 116, 104, 101, 0, 97, 117, 103, 101, 0, 114, 103, 101, 0, 97, 110, 103,
+  101, 0, 115, 97, 103, 101, 0, 109, 97, 103, 101, 0, 107, 97, 103, 101, 0, 117,
+  97, 114, 97, 110, 116, 101, 101, 0, 101, 114, 114, 105, 100, 101, 0, 101, 102,
+  101, 114, 101, 110, 99, 101, 0, 114, 109, 97, 110, 99, 101, 0, 105, 99, 101,
+  0, 112, 97, 99, 101, 0, 114, 102, 97, 99, 101, 0, 114, 105, 98, 101, 0, 114,
+  119, 97, 114, 100, 0, 104, 111, 108, 100, 0, 105, 101, 108, 100, 0, 114, 101,
+  99, 97, 116, 101, 100, 0, 114, 101, 100, 0, 110, 100, 101, 102, 105, 110, 101,
+  100, 0, 103, 110, 101, 100, 0, 110, 97, 109, 105, 99, 0, 101, 109, 97, 0, 100,
+  97, 0};
 
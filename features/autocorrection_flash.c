@@ -0,0 +1,294 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file autocorrection_flash.c
+ * @brief Autocorrection Flash implementation
+ */
+
+#include "features/autocorrection_flash.h"
+
+#include <string.h>
+
+#include "features/autocorrection.h"
+
+#ifdef MCU_RP
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#if __has_include("wear_leveling_rp2040_flash_config.h")
+#include "wear_leveling_rp2040_flash_config.h"
+#endif
+#endif  // MCU_RP
+
+#if AUTOCORRECTION_FLASH_OFFSET % 4096 != 0 || \
+    AUTOCORRECTION_FLASH_SLOT_SIZE % 4096 != 0
+#error "autocorrection_flash: Offset and slot size must be multiples of 4096"
+#endif
+
+#if AUTOCORRECTION_FLASH_SLOT_SIZE < 8192 || \
+    AUTOCORRECTION_FLASH_SLOT_SIZE > 65536
+#error "autocorrection_flash: AUTOCORRECTION_FLASH_SLOT_SIZE must be 8 to 64 KB"
+#endif
+
+#define REGION_END \
+  (AUTOCORRECTION_FLASH_OFFSET + 2 * AUTOCORRECTION_FLASH_SLOT_SIZE)
+#ifdef PICO_FLASH_SIZE_BYTES
+#if REGION_END > PICO_FLASH_SIZE_BYTES
+#error "autocorrection_flash: The region is past the end of flash"
+#endif
+#endif  // PICO_FLASH_SIZE_BYTES
+#if defined(WEAR_LEVELING_RP2040_FLASH_BASE) && \
+    defined(WEAR_LEVELING_BACKING_SIZE)
+#if AUTOCORRECTION_FLASH_OFFSET <                                       \
+        WEAR_LEVELING_RP2040_FLASH_BASE + WEAR_LEVELING_BACKING_SIZE && \
+    WEAR_LEVELING_RP2040_FLASH_BASE < REGION_END
+#error "autocorrection_flash: The region overlaps the wear leveling (EEPROM) area"
+#endif
+#endif  // WEAR_LEVELING_RP2040_FLASH_BASE
+
+#ifdef MCU_RP
+// For the firmware image's check in autocorrection_flash.ld.
+#define STRINGIFY_(x) #x
+#define STRINGIFY(x) STRINGIFY_(x)
+__asm__(".global autocorrection_flash_offset\n"
+        ".set autocorrection_flash_offset, " STRINGIFY(
+            AUTOCORRECTION_FLASH_OFFSET));
+#endif  // MCU_RP
+
+#define SECTOR_SIZE 4096
+#define PAGE_SIZE 256
+// The header takes the first page of a slot, the dictionary the rest.
+#define HEADER_SIZE PAGE_SIZE
+#define MAX_SIZE (AUTOCORRECTION_FLASH_SLOT_SIZE - HEADER_SIZE)
+#define MAGIC 0x31444341  // "ACD1" in little endian.
+
+enum {
+  STATUS_OK = 0,
+  STATUS_OUT_OF_ORDER = 1,
+  STATUS_INVALID = 2,
+  STATUS_CRC_MISMATCH = 3,
+};
+
+// Slot header, as stored in flash. Both platforms are little endian.
+typedef struct {
+  uint32_t magic;
+  uint32_t sequence;
+  uint16_t size;
+  uint8_t min_length;
+  uint8_t max_length;
+  uint32_t crc;
+} header_t;
+
+// Slot in use, or -1 for the built-in dictionary, and its header.
+static int8_t active = -1;
+static header_t active_header = {0};
+
+// Dictionary being written into slot `target`: its header, the number of
+// bytes written and the page they are gathered in before programming.
+static int8_t target = -1;
+static header_t pending = {0};
+static uint16_t written = 0;
+static uint8_t page[PAGE_SIZE];
+
+#ifdef MCU_RP
+const uint8_t* autocorrection_flash_memory(void) {
+  return (const uint8_t*)(XIP_BASE + AUTOCORRECTION_FLASH_OFFSET);
+}
+
+void autocorrection_flash_erase(uint32_t offset, uint32_t size) {
+  // Erase a sector at a time, so that USB interrupts are not held off long.
+  for (uint32_t end = offset + size; offset < end; offset += SECTOR_SIZE) {
+    const uint32_t interrupts = save_and_disable_interrupts();
+    flash_range_erase(AUTOCORRECTION_FLASH_OFFSET + offset, SECTOR_SIZE);
+    restore_interrupts(interrupts);
+  }
+}
+
+void autocorrection_flash_program(uint32_t offset, const uint8_t* data,
+                                  uint32_t size) {
+  const uint32_t interrupts = save_and_disable_interrupts();
+  flash_range_program(AUTOCORRECTION_FLASH_OFFSET + offset, data, size);
+  restore_interrupts(interrupts);
+}
+#endif  // MCU_RP
+
+// CRC-32 of `size` bytes at `data`, as zlib's crc32().
+static uint32_t crc32(const uint8_t* data, uint16_t size) {
+  uint32_t crc = 0xffffffff;
+  for (uint16_t i = 0; i < size; ++i) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+static const uint8_t* slot_memory(uint8_t slot) {
+  return autocorrection_flash_memory() +
+         (uint32_t)slot * AUTOCORRECTION_FLASH_SLOT_SIZE;
+}
+
+static bool header_is_valid(const header_t* header) {
+  return header->magic == MAGIC && 0 < header->size &&
+         header->size <= MAX_SIZE && 4 <= header->min_length &&
+         header->min_length <= header->max_length && header->max_length <= 64;
+}
+
+// Reads the header of `slot`, returning whether the slot holds a dictionary.
+static bool read_slot(uint8_t slot, header_t* header) {
+  memcpy(header, slot_memory(slot), sizeof(header_t));
+  return header_is_valid(header) &&
+         crc32(slot_memory(slot) + HEADER_SIZE, header->size) == header->crc;
+}
+
+static void use_slot(int8_t slot, const header_t* header) {
+  active = slot;
+  if (slot < 0) {
+    autocorrection_set_data(NULL, 0, 0);
+    active_header.size = 0;
+  } else {
+    active_header = *header;
+    autocorrection_set_data(slot_memory(slot) + HEADER_SIZE, header->size,
+                            header->max_length);
+  }
+}
+
+void autocorrection_flash_init(void) {
+  header_t headers[2];
+  const bool valid[2] = {read_slot(0, &headers[0]), read_slot(1, &headers[1])};
+  uint8_t slot = valid[1];  // The valid slot, if only one is.
+  if (valid[0] && valid[1]) {
+    // From the second write on, the older dictionary stays in the other slot.
+    slot = (int32_t)(headers[1].sequence - headers[0].sequence) > 0;
+  }
+  if (valid[slot]) {
+    use_slot(slot, &headers[slot]);
+  }
+}
+
+static uint8_t begin_write(const uint8_t* data) {
+  pending.magic = MAGIC;
+  pending.sequence = active_header.sequence + 1;
+  pending.size = data[2] | (uint16_t)data[3] << 8;
+  pending.min_length = data[4];
+  pending.max_length = data[5];
+  pending.crc = (uint32_t)data[6] | (uint32_t)data[7] << 8 |
+                (uint32_t)data[8] << 16 | (uint32_t)data[9] << 24;
+  if (!header_is_valid(&pending)) {
+    target = -1;
+    return STATUS_INVALID;
+  }
+
+  target = (active == 0) ? 1 : 0;
+  written = 0;
+  autocorrection_flash_erase((uint32_t)target * AUTOCORRECTION_FLASH_SLOT_SIZE,
+                             AUTOCORRECTION_FLASH_SLOT_SIZE);
+  return STATUS_OK;
+}
+
+static void program_page(uint8_t slot, uint16_t page_offset) {
+  autocorrection_flash_program(
+      (uint32_t)slot * AUTOCORRECTION_FLASH_SLOT_SIZE + page_offset, page,
+      PAGE_SIZE);
+}
+
+static uint8_t write_bytes(uint16_t offset, const uint8_t* bytes, uint8_t n) {
+  if (target < 0 || offset != written || n > pending.size - written) {
+    return STATUS_OUT_OF_ORDER;
+  }
+  for (uint8_t i = 0; i < n; ++i) {
+    page[written % PAGE_SIZE] = bytes[i];
+    if (++written % PAGE_SIZE == 0) {
+      program_page(target, HEADER_SIZE + written - PAGE_SIZE);
+    }
+  }
+  return STATUS_OK;
+}
+
+static uint8_t commit(void) {
+  if (target < 0 || written != pending.size) {
+    return STATUS_OUT_OF_ORDER;
+  }
+  const uint8_t slot = target;
+  target = -1;
+  const uint16_t partial = written % PAGE_SIZE;
+  if (partial) {
+    memset(page + partial, 0xff, PAGE_SIZE - partial);
+    program_page(slot, HEADER_SIZE + written - partial);
+  }
+
+  if (crc32(slot_memory(slot) + HEADER_SIZE, pending.size) != pending.crc) {
+    return STATUS_CRC_MISMATCH;
+  }
+  // The header goes last, so that a dictionary cut short is never used.
+  memset(page, 0xff, PAGE_SIZE);
+  memcpy(page, &pending, sizeof(header_t));
+  program_page(slot, 0);
+  use_slot(slot, &pending);
+  return STATUS_OK;
+}
+
+static void use_built_in(void) {
+  target = -1;
+  use_slot(-1, NULL);
+  for (uint8_t slot = 0; slot < 2; ++slot) {
+    autocorrection_flash_erase((uint32_t)slot * AUTOCORRECTION_FLASH_SLOT_SIZE,
+                               SECTOR_SIZE);
+  }
+}
+
+bool autocorrection_flash_raw_hid_receive(uint8_t* data, uint8_t length) {
+  if (length < 16 || data[0] != AUTOCORRECTION_FLASH_RAW_HID_ID) {
+    return false;
+  }
+
+  switch (data[1]) {
+    case 0: {  // Info.
+      const uint16_t max_size = MAX_SIZE;
+      data[2] = active + 1;
+      data[3] = active_header.size & 0xff;
+      data[4] = active_header.size >> 8;
+      for (uint8_t i = 0; i < 4; ++i) {
+        data[5 + i] = (active_header.sequence >> (8 * i)) & 0xff;
+      }
+      data[9] = max_size & 0xff;
+      data[10] = max_size >> 8;
+    } break;
+
+    case 1:  // Begin writing.
+      data[2] = begin_write(data);
+      break;
+
+    case 2: {  // Write data[4] bytes at offset data[2..3].
+      const uint16_t offset = data[2] | (uint16_t)data[3] << 8;
+      const uint8_t n = data[4];
+      data[2] = (n <= length - 5) ? write_bytes(offset, data + 5, n)
+                                  : STATUS_OUT_OF_ORDER;
+    } break;
+
+    case 3:  // Commit.
+      data[2] = commit();
+      break;
+
+    case 4:  // Switch to the built-in dictionary.
+      use_built_in();
+      data[2] = STATUS_OK;
+      break;
+
+    default:
+      return false;
+  }
+  return true;
+}
@@ -0,0 +1,129 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file autocorrection_flash.h
+ * @brief Autocorrection Flash - load autocorrection dictionaries at run time
+ *
+ * Overview
+ * --------
+ *
+ * Autocorrection Flash stores autocorrection dictionaries in a reserved region
+ * of flash, written over raw HID, so that adding a word needs no rebuild or
+ * reflash. A new dictionary takes effect as soon as it is written, and is
+ * used again after a reboot.
+ *
+ * The region has two slots of `AUTOCORRECTION_FLASH_SLOT_SIZE` bytes. A new
+ * dictionary is written into the slot not in use, so the current one keeps
+ * working until the new one is complete and its CRC checks out. Then
+ * `process_autocorrection()` switches to it with `autocorrection_set_data()`.
+ * Each slot starts with a 256-byte page holding a header:
+ *
+ * Bytes | Value
+ * ----- | ------------------------------------------------------------------
+ * 0-3   | Magic number "ACD1"
+ * 4-7   | Sequence number, one more than that of the other slot when written
+ * 8-9   | Size of the dictionary in bytes
+ * 10    | Shortest typo length, at least 4
+ * 11    | Longest typo length, at most 64
+ * 12-15 | CRC-32 of the dictionary, as zlib's crc32()
+ *
+ * The dictionary follows from byte 256: the `autocorrection_data` array that
+ * make_autocorrection_data.py generates. Flash is read in place, as the
+ * built-in dictionary is, so lookups are just as fast. At power on,
+ * `autocorrection_flash_init()` picks the valid slot with the highest
+ * sequence number, or keeps the built-in dictionary if neither is valid.
+ *
+ * Write a dictionary with tools/autocorrection_flash.py:
+ *
+ *     cd features
+ *     python3 make_autocorrection_data.py my_dict.txt /tmp/my_dict.h
+ *     python3 ../tools/autocorrection_flash.py write /tmp/my_dict.h
+ *
+ * On RP2040, flash is erased and programmed with the Pico SDK's
+ * `flash_range_erase()` and `flash_range_program()`, with interrupts off; the
+ * keyboard pauses for about 50 ms per 4 KB sector erased. Other platforms must
+ * provide the three `autocorrection_flash_*()` platform functions below.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Offset of the region in flash, a multiple of 4096. The default is 1 MB in,
+ * past the firmware and clear of the wear leveling (EEPROM) area at the end.
+ * The build fails if the region overlaps either, or is past the end of flash.
+ */
+#ifndef AUTOCORRECTION_FLASH_OFFSET
+#define AUTOCORRECTION_FLASH_OFFSET (1024 * 1024)
+#endif  // AUTOCORRECTION_FLASH_OFFSET
+
+/** Size of each of the two slots, a multiple of 4096. */
+#ifndef AUTOCORRECTION_FLASH_SLOT_SIZE
+#define AUTOCORRECTION_FLASH_SLOT_SIZE 32768
+#endif  // AUTOCORRECTION_FLASH_SLOT_SIZE
+
+/** First byte of raw HID requests handled by Autocorrection Flash. */
+#ifndef AUTOCORRECTION_FLASH_RAW_HID_ID
+#define AUTOCORRECTION_FLASH_RAW_HID_ID 0x41
+#endif  // AUTOCORRECTION_FLASH_RAW_HID_ID
+
+/** Switches to the newest valid dictionary in flash, if any. Call at init. */
+void autocorrection_flash_init(void);
+
+/**
+ * Handles a raw HID request, replying in place in `data`. Returns true if the
+ * request was for Autocorrection Flash, in which case the caller should send
+ * `data` back with `raw_hid_send()`.
+ *
+ * Requests start with `AUTOCORRECTION_FLASH_RAW_HID_ID` followed by a command:
+ *
+ * Request                  | Reply
+ * ------------------------ | -----------------------------------------------
+ * id, 0                    | id, 0, slot in use (0 if the built-in
+ *                          | dictionary), size (2 bytes), sequence number (4
+ *                          | bytes), largest size that fits (2 bytes)
+ * id, 1, size (2), shortest| id, 1, status; starts writing a dictionary by
+ * typo, longest typo,      | erasing the slot not in use
+ * CRC-32 (4)               |
+ * id, 2, offset (2), n,    | id, 2, status; writes n bytes of the dictionary,
+ * then n bytes             | which must follow the bytes written before
+ * id, 3                    | id, 3, status; checks the CRC, writes the header
+ *                          | and switches to the new dictionary
+ * id, 4                    | id, 4, status; switches to the built-in
+ *                          | dictionary and erases both slots' headers
+ *
+ * Status is 0 on success, 1 for a request out of order, 2 for a dictionary too
+ * large or with typos too short or long, and 3 for a CRC mismatch. Multibyte
+ * values are little endian.
+ */
+bool autocorrection_flash_raw_hid_receive(uint8_t* data, uint8_t length);
+
+/**
+ * Platform functions. `offset` and `size` are relative to the region and
+ * multiples of 4096 for erasing and of 256 for programming.
+ */
+const uint8_t* autocorrection_flash_memory(void);
+void autocorrection_flash_erase(uint32_t offset, uint32_t size);
+void autocorrection_flash_program(uint32_t offset, const uint8_t* data,
+                                  uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
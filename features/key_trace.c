@@ -0,0 +1,161 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file key_trace.c
+ * @brief Key Trace implementation
+ */
+
+#include "features/key_trace.h"
+
+#if (KEY_TRACE_BUFFER_SIZE & (KEY_TRACE_BUFFER_SIZE - 1)) != 0 || \
+    KEY_TRACE_BUFFER_SIZE < 16 || KEY_TRACE_BUFFER_SIZE > 32768
+#error "key_trace: KEY_TRACE_BUFFER_SIZE must be a power of 2, 16 to 32768"
+#endif
+
+#if MATRIX_ROWS > 16 || MATRIX_COLS > 8
+#error "key_trace: The matrix must be at most 16 rows by 8 columns"
+#endif
+
+#define BUFFER_MASK (KEY_TRACE_BUFFER_SIZE - 1)
+// Longest encoding of an event: key byte and a 32-bit varint.
+#define MAX_EVENT_SIZE 6
+
+static uint8_t buffer[KEY_TRACE_BUFFER_SIZE];
+// Index of the oldest byte, and number of bytes used.
+static uint16_t start = 0;
+static uint16_t size = 0;
+static uint32_t num_events = 0;
+static bool recording = true;
+
+// Time of the last recorded event, in ms: the 16-bit event time for short
+// gaps, and the 32-bit timer for gaps too long for 16 bits.
+static uint16_t last_time = 0;
+static uint32_t last_timer = 0;
+
+static uint8_t at(uint16_t offset) {
+  return buffer[(start + offset) & BUFFER_MASK];
+}
+
+// Drops the oldest event.
+static void drop_oldest(void) {
+  uint16_t n = 1;  // Key byte.
+  while (n < size && (at(n) & 0x80)) {
+    ++n;
+  }
+  ++n;  // Last varint byte.
+  start = (start + n) & BUFFER_MASK;
+  size -= n;
+  --num_events;
+}
+
+void pre_process_key_trace(keyrecord_t* record) {
+  const keypos_t key = record->event.key;
+  if (!recording || !IS_KEYEVENT(record->event) || key.row >= MATRIX_ROWS ||
+      key.col >= MATRIX_COLS) {
+    return;
+  }
+
+  uint32_t delta = 0;
+  if (num_events > 0) {
+    const uint32_t elapsed = timer_elapsed32(last_timer);
+    delta = (elapsed < 0x8000) ? (uint16_t)(record->event.time - last_time)
+                               : elapsed;
+  }
+  last_time = record->event.time;
+  last_timer = timer_read32();
+
+  uint8_t event[MAX_EVENT_SIZE];
+  uint8_t n = 0;
+  event[n++] = (record->event.pressed ? 0x80 : 0) | key.row << 3 | key.col;
+  for (; delta >= 0x80; delta >>= 7) {
+    event[n++] = 0x80 | (delta & 0x7f);
+  }
+  event[n++] = delta;
+
+  while (size + n > KEY_TRACE_BUFFER_SIZE) {
+    drop_oldest();
+  }
+  for (uint8_t i = 0; i < n; ++i) {
+    buffer[(start + size++) & BUFFER_MASK] = event[i];
+  }
+  ++num_events;
+}
+
+void key_trace_set_recording(bool on) {
+  recording = on;
+}
+
+bool key_trace_is_recording(void) {
+  return recording;
+}
+
+void key_trace_clear(void) {
+  start = 0;
+  size = 0;
+  num_events = 0;
+}
+
+uint16_t key_trace_size(void) {
+  return size;
+}
+
+uint16_t key_trace_read(uint16_t offset, uint8_t* dest, uint16_t n) {
+  if (offset >= size) {
+    return 0;
+  }
+  if (n > size - offset) {
+    n = size - offset;
+  }
+  for (uint16_t i = 0; i < n; ++i) {
+    dest[i] = at(offset + i);
+  }
+  return n;
+}
+
+bool key_trace_raw_hid_receive(uint8_t* data, uint8_t length) {
+  if (length < 16 || data[0] != KEY_TRACE_RAW_HID_ID) {
+    return false;
+  }
+
+  switch (data[1]) {
+    case 0: {  // Info.
+      const uint32_t buffer_size = KEY_TRACE_BUFFER_SIZE;
+      data[2] = recording;
+      data[3] = size & 0xff;
+      data[4] = size >> 8;
+      for (uint8_t i = 0; i < 4; ++i) {
+        data[5 + i] = (buffer_size >> (8 * i)) & 0xff;
+        data[9 + i] = (num_events >> (8 * i)) & 0xff;
+      }
+    } break;
+
+    case 1: {  // Read at offset data[2..3].
+      const uint16_t offset = data[2] | (uint16_t)data[3] << 8;
+      data[4] = key_trace_read(offset, data + 5, length - 5);
+    } break;
+
+    case 2:  // Clear.
+      key_trace_clear();
+      break;
+
+    case 3:  // Start or pause recording.
+      key_trace_set_recording(data[2]);
+      break;
+
+    default:
+      return false;
+  }
+  return true;
+}
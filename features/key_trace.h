@@ -0,0 +1,117 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file key_trace.h
+ * @brief Key Trace - record physical key events for offline replay
+ *
+ * Overview
+ * --------
+ *
+ * Key Trace records every matrix key press and release, with its timing, into
+ * a ring buffer in RAM. Read over raw HID, the trace replays in the host
+ * simulator (tools/sim) to tune tap-hold settings, autocorrect and Sentence
+ * Case on real typing.
+ *
+ * Each event takes 2 bytes, or 3 after a pause of 128 ms or more:
+ *
+ *  * One byte with the key position, `pressed << 7 | row << 3 | col`, so the
+ *    matrix must be at most 16 rows by 8 columns.
+ *  * The time in ms since the previous event, as a LEB128 varint: 7 bits per
+ *    byte, low bits first, with the high bit set on all but the last byte.
+ *
+ * The default 8 KB buffer holds some 3700 events, about 5 minutes of typing
+ * at 60 WPM. When it fills, the oldest events are dropped. The first event's
+ * time is then relative to a dropped event.
+ *
+ * Events are recorded in `pre_process_record_user()`, before combos, tap-hold
+ * resolution and every feature handler, in the order and with the timing they
+ * happened on the matrix:
+ *
+ *     #include "features/key_trace.h"
+ *
+ *     bool pre_process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       pre_process_key_trace(record);
+ *       return true;
+ *     }
+ *
+ * Read the trace with tools/key_trace.py, which speaks the raw HID protocol
+ * of `key_trace_raw_hid_receive()` and writes the simulator's trace format.
+ *
+ * @warning The trace holds everything typed, passwords included. Pause
+ * recording before typing secrets, and clear the trace after reading it.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Size of the ring buffer in bytes, a power of 2. */
+#ifndef KEY_TRACE_BUFFER_SIZE
+#define KEY_TRACE_BUFFER_SIZE 8192
+#endif  // KEY_TRACE_BUFFER_SIZE
+
+/** First byte of raw HID requests handled by Key Trace. */
+#ifndef KEY_TRACE_RAW_HID_ID
+#define KEY_TRACE_RAW_HID_ID 0x54
+#endif  // KEY_TRACE_RAW_HID_ID
+
+/** Records the event if recording. Call from `pre_process_record_user()`. */
+void pre_process_key_trace(keyrecord_t* record);
+
+/** Starts or pauses recording. Recording is on at power on. */
+void key_trace_set_recording(bool on);
+
+/** Gets whether recording. */
+bool key_trace_is_recording(void);
+
+/** Clears the trace. */
+void key_trace_clear(void);
+
+/** Gets the size of the trace in bytes. */
+uint16_t key_trace_size(void);
+
+/**
+ * Copies up to `size` bytes of the trace starting `offset` bytes after its
+ * oldest byte into `dest`. Returns the number of bytes copied.
+ */
+uint16_t key_trace_read(uint16_t offset, uint8_t* dest, uint16_t size);
+
+/**
+ * Handles a raw HID request, replying in place in `data`. Returns true if the
+ * request was for Key Trace, in which case the caller should send `data` back
+ * with `raw_hid_send()`.
+ *
+ * Requests start with `KEY_TRACE_RAW_HID_ID` followed by a command:
+ *
+ * Request              | Reply
+ * -------------------- | ---------------------------------------------------
+ * id, 0                | id, 0, recording, size (2 bytes), buffer size (4
+ *                      | bytes), number of events (4 bytes)
+ * id, 1, offset (2)    | id, 1, offset (2), n, then n bytes of the trace
+ * id, 2                | id, 2; the trace is cleared
+ * id, 3, on            | id, 3, on; recording is started or paused
+ *
+ * Multibyte values are little endian. Pause recording while reading, so that
+ * offsets stay put.
+ */
+bool key_trace_raw_hid_receive(uint8_t* data, uint8_t length);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,166 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file latency_stats.c
+ * @brief Latency Stats implementation
+ */
+
+#include "features/latency_stats.h"
+
+#include <string.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#include <ch.h>
+#endif  // PROTOCOL_CHIBIOS
+
+#if LATENCY_STATS_NUM_STAGES < 1 || LATENCY_STATS_NUM_STAGES > 32
+#error "latency_stats: LATENCY_STATS_NUM_STAGES must be between 1 and 32"
+#endif
+
+// Bucket b of the histogram counts times whose bit length is b, i.e. times in
+// [2^(b - 1), 2^b - 1], where time 0 goes in bucket 0.
+#define NUM_BUCKETS 17
+
+typedef struct {
+  uint32_t count;
+  uint32_t sum;
+  uint16_t min;
+  uint16_t max;
+  uint16_t histogram[NUM_BUCKETS];
+} stage_t;
+
+static stage_t stages[LATENCY_STATS_NUM_STAGES];
+
+__attribute__((weak)) uint32_t latency_stats_timer(void) {
+#ifdef PROTOCOL_CHIBIOS
+  return (uint32_t)TIME_I2US(chVTGetSystemTimeX());
+#else
+  return timer_read32() * 1000;
+#endif  // PROTOCOL_CHIBIOS
+}
+
+static uint8_t bit_length(uint16_t x) {
+  uint8_t n = 0;
+  for (; x; x >>= 1) {
+    ++n;
+  }
+  return n;
+}
+
+void latency_stats_add(uint8_t stage, uint32_t elapsed) {
+  if (stage >= LATENCY_STATS_NUM_STAGES) {
+    return;
+  }
+  stage_t* s = &stages[stage];
+  const uint16_t t = elapsed < UINT16_MAX ? elapsed : UINT16_MAX;
+
+  if (s->count == 0 || t < s->min) {
+    s->min = t;
+  }
+  if (t > s->max) {
+    s->max = t;
+  }
+  ++s->count;
+  s->sum += t;
+
+  uint16_t* bucket = &s->histogram[bit_length(t)];
+  if (*bucket == UINT16_MAX) {
+    // Halve all buckets to make room. This keeps the shape of the histogram.
+    for (uint8_t b = 0; b < NUM_BUCKETS; ++b) {
+      s->histogram[b] = (s->histogram[b] + 1) / 2;
+    }
+  }
+  ++*bucket;
+}
+
+latency_stats_t latency_stats_get(uint8_t stage) {
+  latency_stats_t result = {0};
+  if (stage >= LATENCY_STATS_NUM_STAGES || stages[stage].count == 0) {
+    return result;
+  }
+  const stage_t* s = &stages[stage];
+  result.count = s->count;
+  result.min = s->min;
+  result.max = s->max;
+  result.mean = s->sum / s->count;
+
+  uint32_t total = 0;
+  for (uint8_t b = 0; b < NUM_BUCKETS; ++b) {
+    total += s->histogram[b];
+  }
+  // Find the first bucket where the cumulative count reaches 99%.
+  const uint32_t rank = total - total / 100;
+  uint32_t cumulative = 0;
+  for (uint8_t b = 0; b < NUM_BUCKETS; ++b) {
+    cumulative += s->histogram[b];
+    if (cumulative >= rank) {
+      const uint16_t upper = (uint16_t)((1UL << b) - 1);
+      result.p99 = upper < s->max ? upper : s->max;
+      break;
+    }
+  }
+  return result;
+}
+
+void latency_stats_reset(void) {
+  memset(stages, 0, sizeof(stages));
+}
+
+void latency_stats_print(const char* const* names) {
+#ifdef CONSOLE_ENABLE
+  uprintf("%-20s %10s %6s %6s %6s %6s\n", "latency (" LATENCY_STATS_UNIT ")",
+          "count", "min", "mean", "p99", "max");
+  for (uint8_t i = 0; i < LATENCY_STATS_NUM_STAGES; ++i) {
+    const latency_stats_t s = latency_stats_get(i);
+    if (names) {
+      uprintf("%-20s", names[i]);
+    } else {
+      uprintf("stage %-14u", i);
+    }
+    uprintf(" %10lu %6u %6u %6u %6u\n", (unsigned long)s.count, s.min, s.mean,
+            s.p99, s.max);
+  }
+#endif  // CONSOLE_ENABLE
+}
+
+bool latency_stats_raw_hid_receive(uint8_t* data, uint8_t length) {
+  if (length < 16 || data[0] != LATENCY_STATS_RAW_HID_ID) {
+    return false;
+  }
+
+  switch (data[1]) {
+    case 0: {  // Get the stats of stage data[2].
+      const latency_stats_t s = latency_stats_get(data[2]);
+      data[3] = LATENCY_STATS_NUM_STAGES;
+      data[4] = s.count & 0xff;
+      data[5] = (s.count >> 8) & 0xff;
+      data[6] = (s.count >> 16) & 0xff;
+      data[7] = s.count >> 24;
+      const uint16_t values[4] = {s.min, s.mean, s.p99, s.max};
+      for (uint8_t i = 0; i < 4; ++i) {
+        data[8 + 2 * i] = values[i] & 0xff;
+        data[9 + 2 * i] = values[i] >> 8;
+      }
+    } break;
+
+    case 1:  // Reset.
+      latency_stats_reset();
+      break;
+
+    default:
+      return false;
+  }
+  return true;
+}
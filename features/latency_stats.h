@@ -0,0 +1,150 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file latency_stats.h
+ * @brief Latency Stats - per-stage timing of key event handling
+ *
+ * Overview
+ * --------
+ *
+ * Latency Stats times the stages of `process_record_user()`, e.g. each feature
+ * handler, to find which one adds latency to a keypress. For each stage it
+ * keeps the number of events and the min, mean, 99th percentile and max time
+ * in RAM.
+ *
+ * It is opt-in. Enable it in rules.mk with
+ *
+ *     LATENCY_STATS_ENABLE = yes
+ *
+ * Otherwise `LATENCY_STATS_SCOPE()` compiles to nothing.
+ *
+ * Number the stages from 0 and set `LATENCY_STATS_NUM_STAGES` in config.h.
+ * Then start a stage at the top of a block. It is timed until the block is
+ * left, including by `return`:
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       {
+ *         LATENCY_STATS_SCOPE(STAGE_SOCD);
+ *         if (!process_socd_cleaner(keycode, record, &socd_v)) { return false; }
+ *       }
+ *       // ...
+ *     }
+ *
+ * Times are read with `latency_stats_timer()`, in microseconds from the system
+ * timer, which runs at 1 MHz on RP2040. The p99 comes from a histogram with
+ * power-of-two buckets, so it is the upper bound of the bucket it falls in.
+ *
+ * To read the stats, call `latency_stats_print()` (needs `CONSOLE_ENABLE`) or
+ * `latency_stats_raw_hid_receive()` from `raw_hid_receive()` (needs
+ * `RAW_ENABLE`).
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef LATENCY_STATS_NUM_STAGES
+#define LATENCY_STATS_NUM_STAGES 8
+#endif  // LATENCY_STATS_NUM_STAGES
+
+/** Unit of `latency_stats_timer()`, used when printing. */
+#ifndef LATENCY_STATS_UNIT
+#define LATENCY_STATS_UNIT "us"
+#endif  // LATENCY_STATS_UNIT
+
+/** First byte of raw HID requests handled by Latency Stats. */
+#ifndef LATENCY_STATS_RAW_HID_ID
+#define LATENCY_STATS_RAW_HID_ID 0x4c
+#endif  // LATENCY_STATS_RAW_HID_ID
+
+/** Summary of one stage's times. */
+typedef struct {
+  uint32_t count;
+  uint16_t min;
+  uint16_t mean;
+  /** Upper bound on the 99th percentile. */
+  uint16_t p99;
+  uint16_t max;
+} latency_stats_t;
+
+#ifdef LATENCY_STATS_ENABLE
+
+/** Reads the current time, in microseconds. Weak; may be redefined. */
+uint32_t latency_stats_timer(void);
+
+/** Adds one event to `stage` that took `elapsed` time. */
+void latency_stats_add(uint8_t stage, uint32_t elapsed);
+
+/** Gets the summary for `stage`. */
+latency_stats_t latency_stats_get(uint8_t stage);
+
+/** Clears all stages. */
+void latency_stats_reset(void);
+
+/**
+ * Prints a table of all stages to the console. `names` gives a name for each
+ * stage, or may be NULL to print stage numbers.
+ */
+void latency_stats_print(const char* const* names);
+
+/**
+ * Handles a raw HID request, replying in place in `data`. Returns true if the
+ * request was for Latency Stats, in which case the caller should send `data`
+ * back with `raw_hid_send()`.
+ *
+ * Requests start with `LATENCY_STATS_RAW_HID_ID` followed by a command:
+ *
+ * Request        | Reply
+ * -------------- | --------------------------------------------------------
+ * id, 0, stage   | id, 0, stage, num stages, count (4 bytes), min, mean,
+ *                | p99, max (2 bytes each), all little endian
+ * id, 1          | id, 1; all stages are cleared
+ */
+bool latency_stats_raw_hid_receive(uint8_t* data, uint8_t length);
+
+typedef struct {
+  uint8_t stage;
+  uint32_t start;
+} latency_stats_scope_t;
+
+static inline latency_stats_scope_t latency_stats_scope_begin(uint8_t stage) {
+  return (latency_stats_scope_t){stage, latency_stats_timer()};
+}
+
+static inline void latency_stats_scope_end(latency_stats_scope_t* scope) {
+  latency_stats_add(scope->stage, latency_stats_timer() - scope->start);
+}
+
+/** Times `stage` from here until the end of the enclosing block. */
+#define LATENCY_STATS_SCOPE(stage)                        \
+  latency_stats_scope_t latency_stats_scope_              \
+      __attribute__((cleanup(latency_stats_scope_end))) = \
+          latency_stats_scope_begin(stage)
+
+#else
+
+#define LATENCY_STATS_SCOPE(stage) \
+  do {                             \
+  } while (0)
+
+#endif  // LATENCY_STATS_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
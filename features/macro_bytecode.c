@@ -0,0 +1,49 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file macro_bytecode.c
+ * @brief Macro Bytecode implementation
+ */
+
+#include "features/macro_bytecode.h"
+
+#include "features/output_queue.h"
+
+void macro_bytecode_run_P(const char* program) {
+  for (;;) {
+    const uint8_t op = pgm_read_byte(program++);
+    switch (op) {
+      case 0:
+        return;
+
+      case BC_OP_TAP:
+        output_queue_tap_code(pgm_read_byte(program++));
+        break;
+
+      case BC_OP_TAP_MODS: {
+        const uint8_t mods = pgm_read_byte(program++);
+        output_queue_tap_code16((uint16_t)mods << 8 | pgm_read_byte(program++));
+      } break;
+
+      case BC_OP_DELAY:
+        output_queue_delay(pgm_read_byte(program++));
+        break;
+
+      default:
+        output_queue_send_char((char)op);
+        break;
+    }
+  }
+}
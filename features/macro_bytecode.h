@@ -0,0 +1,76 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file macro_bytecode.h
+ * @brief Macro Bytecode - macros as compact PROGMEM programs
+ *
+ * Overview
+ * --------
+ *
+ * A macro written as a sequence of `tap_code()`, `tap_code16()` and
+ * `SEND_STRING()` calls costs a few dozen bytes of code per call site. This
+ * library instead stores each macro as a short program in a PROGMEM string,
+ * run by a small interpreter that sends the output through the Output Queue.
+ *
+ * A program is a NUL-terminated string. Printable ASCII characters and `\n`
+ * are typed like `SEND_STRING()` does; bytes 1 to 3 are ops that take one or
+ * two argument bytes. Programs are written with the macros below and string
+ * concatenation, for instance Vim's save:
+ *
+ *     BC_TAP(X_ESC) ":w" BC_TAP(X_ENT)
+ *
+ * Op                  | Bytes              | Effect
+ * ------------------- | ------------------ | -----------------------------
+ * `BC_TAP(x)`         | 1, keycode         | Tap `X_` keycode x.
+ * `BC_LCTL(x)`, etc.  | 2, mods, keycode   | Tap x with 5-bit mods.
+ * `BC_DELAY(ms)`      | 3, ms              | Pause, ms given in hex, 01-ff.
+ *
+ * To look up a program by keycode without a pointer per macro, define the
+ * programs as members of one PROGMEM struct and index a table of their
+ * offsets, as keymap.c does for its Vim, tmux and Harpoon macros.
+ *
+ * @note Requires features/output_queue.c.
+ */
+
+#pragma once
+
+#include <stddef.h>  // For offsetof(), used to index program tables.
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Op byte values. Any other nonzero byte is typed as an ASCII character. */
+enum {
+  BC_OP_TAP = 1,
+  BC_OP_TAP_MODS = 2,
+  BC_OP_DELAY = 3,
+};
+
+#define BC_TAP(keycode) "\1" SS_ADD_SLASH_X(keycode)
+#define BC_LCTL(keycode) "\2\1" SS_ADD_SLASH_X(keycode)
+#define BC_LSFT(keycode) "\2\2" SS_ADD_SLASH_X(keycode)
+#define BC_LALT(keycode) "\2\4" SS_ADD_SLASH_X(keycode)
+#define BC_LGUI(keycode) "\2\x08" SS_ADD_SLASH_X(keycode)
+#define BC_DELAY(ms_hex) "\3" SS_ADD_SLASH_X(ms_hex)
+
+/** Runs a PROGMEM macro program, queuing its output. */
+void macro_bytecode_run_P(const char* program);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,64 @@
+// Generated code.
+
+// Magic trigram dictionary (35 entries):
+//   :ab -> out
+//   :ag -> ain
+//   :al -> ways
+//   :an -> other
+//   :ar -> ound
+//   :be -> cause
+//   :di -> fferent
+//   :ev -> ery
+//   :fr -> om
+//   :ha -> ve
+//   :im -> portant
+//   :ju -> st
+//   :kn -> ow
+//   :li -> ke
+//   :nu -> mber
+//   :ot -> her
+//   :pe -> ople
+//   :pr -> oblem
+//   :ri -> ght
+//   :sa -> me
+//   :sh -> ould
+//   :st -> ill
+//   :th -> at
+//   :un -> til
+//   :us -> ing
+//   :wh -> ich
+//   :wi -> th
+//   :wo -> uld
+//   :yo -> ur
+//   ab  -> le
+//   gh  -> t
+//   ib  -> le
+//   ou  -> gh
+//   si  -> on
+//   ti  -> on
+
+#define MAGIC_TRIGRAM_SEED 5
+#define MAGIC_TRIGRAM_NUM_BUCKETS 12
+#define MAGIC_TRIGRAM_NUM_SLOTS 38
+
+static const uint8_t magic_trigram_displacements[12] PROGMEM = {0, 0, 11, 0, 9,
+  11, 190, 14, 9, 14, 6, 3};
+
+static const uint16_t magic_trigram_keys[38] PROGMEM = {28257, 0, 501, 28148,
+  27830, 27694, 27717, 28463, 232, 27989, 28393, 28392, 290, 28178, 27692, 34,
+  27785, 28399, 27905, 28339, 27682, 27687, 28264, 617, 28041, 28334, 27698,
+  28233, 0, 28296, 649, 0, 27949, 28276, 28165, 27858, 28117, 28014};
+
+static const uint16_t magic_trigram_offsets[38] PROGMEM = {100, 0, 91, 24, 71,
+  22, 16, 118, 6, 115, 94, 67, 51, 28, 34, 51, 0, 55, 112, 59, 79, 63, 54, 109,
+  121, 87, 44, 83, 0, 106, 109, 0, 8, 75, 49, 103, 39, 97};
+
+static const char magic_trigram_texts[124] PROGMEM = {102, 102, 101, 114, 101,
+  110, 116, 0, 112, 111, 114, 116, 97, 110, 116, 0, 99, 97, 117, 115, 101, 0,
+  111, 116, 104, 101, 114, 0, 111, 98, 108, 101, 109, 0, 119, 97, 121, 115, 0,
+  109, 98, 101, 114, 0, 111, 117, 110, 100, 0, 111, 112, 108, 101, 0, 111, 117,
+  108, 100, 0, 105, 110, 103, 0, 97, 105, 110, 0, 105, 99, 104, 0, 101, 114,
+  121, 0, 105, 108, 108, 0, 111, 117, 116, 0, 103, 104, 116, 0, 116, 105, 108,
+  0, 103, 104, 0, 116, 104, 0, 111, 119, 0, 109, 101, 0, 111, 109, 0, 97, 116,
+  0, 111, 110, 0, 118, 101, 0, 115, 116, 0, 117, 114, 0, 107, 101, 0};
+
@@ -0,0 +1,98 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file magic_trigrams.c
+ * @brief Magic Trigrams implementation
+ */
+
+#include "features/magic_trigrams.h"
+
+#include "features/magic_trigram_data.h"
+
+// 5-bit codes of keys in a context, as in make_magic_trigram_data.py.
+#define CODE_NONE 0
+#define CODE_WORD_BREAK 27
+
+// The last three keys as 5-bit codes, newest in the low bits.
+static uint16_t history = 0;
+
+static uint8_t keycode_to_code(uint16_t keycode) {
+  switch (keycode) {
+    case KC_A ... KC_Z:
+      return keycode - KC_A + 1;
+    case KC_1 ... KC_0:
+    case KC_ENT:
+    case KC_TAB:
+    case KC_SPC ... KC_SLSH:
+      return CODE_WORD_BREAK;
+  }
+  return CODE_NONE;
+}
+
+static void record_code(uint8_t code) {
+  history = ((history << 5) | code) & 0x7fff;
+}
+
+void magic_trigrams_record(uint16_t tap_keycode) {
+  record_code(keycode_to_code(tap_keycode));
+}
+
+void magic_trigrams_record_string_P(const char* str) {
+  for (char c; (c = pgm_read_byte(str)); ++str) {
+    if ('a' <= c && c <= 'z') {
+      record_code(c - 'a' + 1);
+    } else if ('A' <= c && c <= 'Z') {
+      record_code(c - 'A' + 1);
+    } else {
+      record_code(c == ' ' ? CODE_WORD_BREAK : CODE_NONE);
+    }
+  }
+}
+
+static const char* find(uint16_t key) {
+  const uint32_t h1 = (uint32_t)(key ^ MAGIC_TRIGRAM_SEED) * 0x9E3779B1u;
+  const uint16_t bucket = ((h1 >> 16) * MAGIC_TRIGRAM_NUM_BUCKETS) >> 16;
+  const uint16_t h2 =
+      ((uint32_t)(key ^ MAGIC_TRIGRAM_SEED) * 0x85EBCA6Bu) >> 16;
+  const uint16_t displacement =
+      pgm_read_byte(&magic_trigram_displacements[bucket]) * 0x9E37u;
+  const uint16_t slot =
+      ((uint32_t)(uint16_t)(h2 ^ displacement) * MAGIC_TRIGRAM_NUM_SLOTS) >> 16;
+
+  if (pgm_read_word(&magic_trigram_keys[slot]) != key) {
+    return NULL;
+  }
+  return magic_trigram_texts + pgm_read_word(&magic_trigram_offsets[slot]);
+}
+
+const char* magic_trigrams_lookup(uint16_t tap_keycode) {
+  const uint8_t last = history & 0x1f;
+  // The last key may have been set by a macro without going through the
+  // history, in which case the history is no context for it.
+  if (last == CODE_NONE || last != keycode_to_code(tap_keycode)) {
+    return NULL;
+  }
+  if ((history >> 5 & 0x1f) == CODE_NONE) {
+    return NULL;  // Less than two keys of context.
+  }
+
+  if (history >> 10) {
+    const char* text = find(history);
+    if (text) {
+      return text;
+    }
+  }
+  return find(history & 0x3ff);
+}
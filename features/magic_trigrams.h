@@ -0,0 +1,71 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file magic_trigrams.h
+ * @brief Magic Trigrams - magic key completions from the last few keys
+ *
+ * Overview
+ * --------
+ *
+ * QMK's Alternate Repeat key only sees the last key. Magic Trigrams keeps the
+ * last three keys typed, so that the magic key can complete from more
+ * context, e.g. "th" * -> "that" but "sh" * -> "should".
+ *
+ * Completions are listed in magic_trigram_dict.txt as "context -> text",
+ * where the context is two or three keys and ':' is a word break:
+ *
+ *     :th -> at
+ *     :sh -> ould
+ *     ti  -> on
+ *
+ * make_magic_trigram_data.py compiles the list into magic_trigram_data.h, a
+ * perfect hash table: looking up a context hashes it once and compares one
+ * key, however many entries there are. A lookup tries the three-key context,
+ * then the two-key context. Each entry takes about 4.5 bytes plus its text,
+ * and texts that are suffixes of others are shared.
+ *
+ * Record each key in `remember_last_key_user()`, and anything typed by
+ * macros with `magic_trigrams_record_string_P()`. Then in
+ * `get_alt_repeat_key_keycode_user()`:
+ *
+ *     const char* text = magic_trigrams_lookup(tap_keycode);
+ *     if (text) {
+ *       // Type the PROGMEM string `text`.
+ *     }
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Adds `tap_keycode` to the history of keys typed. */
+void magic_trigrams_record(uint16_t tap_keycode);
+
+/** Adds the characters of PROGMEM string `str` to the history. */
+void magic_trigrams_record_string_P(const char* str);
+
+/**
+ * Looks up the completion for the history, which must end with
+ * `tap_keycode`, the last key. Returns a PROGMEM string, or NULL if none.
+ */
+const char* magic_trigrams_lookup(uint16_t tap_keycode);
+
+#ifdef __cplusplus
+}
+#endif
@@ -15,8 +15,8 @@
 """Python program to make autocorrection_data.h.
 
 This program reads "autocorrection_dict.txt" from the current directory and
-generates a C source file "autocorrection_data.h" with a serialized trie
-embedded as an array. Run this program without arguments like
+generates a C source file "autocorrection_data.h" with a serialized
+Aho-Corasick automaton embedded as an array. Run this program without arguments like
 
 $ python3 make_autocorrection_data.py
 
@@ -46,10 +46,11 @@ For full documentation, see
 https://getreuer.info/posts/keyboards/autocorrection
 """
 
+import collections
 import os.path
 import sys
 import textwrap
-from typing import Any, Dict, Iterator, List, Tuple
+from typing import Any, Dict, Iterable, Iterator, List, Tuple
 
 try:
   from english_words import english_words_lower_alpha_set as CORRECT_WORDS
@@ -77,6 +78,13 @@ TYPO_CHARS = dict(
   [(chr(c), c + KC_A - ord('a')) for c in range(ord('a'), ord('z') + 1)]
 )
 
+# Bit of each typo character in the child bitmap of a branch node: a-z are bits
+# 0-25, the word break is bit 26 and ' is bit 27.
+TYPO_CHAR_BITS = dict(
+  [(chr(c), c - ord('a')) for c in range(ord('a'), ord('z') + 1)] +
+  [(':', 26), ("'", 27)]
+)
+
 
 def parse_file(file_name: str) -> List[Tuple[str, str]]:
   """Parses autocorrections dictionary file.
@@ -123,22 +131,64 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
   return autocorrections
 
 
-def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
-  """Makes a trie from the the typos, writing in reverse.
+def make_automaton(
+    autocorrections: List[Tuple[str, str]]) -> List[Dict[str, Any]]:
+  """Makes an Aho-Corasick automaton that matches the typos.
+
+  The states are the prefixes of the typos, with the empty prefix as state 0.
+  On each typed character, the automaton goes to the state of the longest
+  prefix that the typed text ends with, so that it reaches the state of a whole
+  typo when the typo is typed.
 
   Args:
     autocorrections: List of (typo, correction) tuples.
   Returns:
-    Dict of dict, representing the trie.
+    List of states in breadth first order. Each is a dict with the state's
+    'depth', its 'last' character, its trie 'children', its 'fail' link to the
+    state of the longest proper suffix, its transition 'next' for each
+    character of TYPO_CHARS, and 'leaf', the (typo, correction) tuple it
+    matches or None.
   """
-  trie = {}
+  states = [{'depth': 0, 'last': None, 'children': {}, 'leaf': None}]
   for typo, correction in autocorrections:
-    node = trie
-    for letter in typo[::-1]:
-      node = node.setdefault(letter, {})
-    node['LEAF'] = (typo, correction)
-
-  return trie
+    state = states[0]
+    for c in typo:
+      if c not in state['children']:
+        state['children'][c] = {'depth': state['depth'] + 1, 'last': c,
+                                'children': {}, 'leaf': None}
+      state = state['children'][c]
+    state['leaf'] = (typo, correction)
+
+  # Number the states in breadth first order, so that each failure link, to
+  # the state of the longest proper suffix, points to a state done earlier.
+  queue = collections.deque([states[0]])
+  states[0]['fail'] = states[0]
+  states.clear()
+  while queue:
+    state = queue.popleft()
+    state['index'] = len(states)
+    states.append(state)
+    fail = state['fail']
+    state['next'] = {}
+    for c in TYPO_CHARS:
+      child = state['children'].get(c)
+      if child:
+        child['fail'] = fail['next'][c] if state['depth'] else state
+        state['next'][c] = child
+        queue.append(child)
+      else:
+        state['next'][c] = fail['next'][c] if state['depth'] else state
+
+  # Output links would chain each state to the typos it ends with. Since typos
+  # are not substrings of one another (parse_file checks), the only typo a
+  # state can end with is its own, which the C code then finds without them.
+  for state in states:
+    suffix = state['fail']
+    while suffix['depth']:
+      assert not suffix['leaf']
+      suffix = suffix['fail']
+
+  return states
 
 
 def parse_file_lines(file_name: str) -> Iterator[Tuple[int, str, str]]:
@@ -186,78 +236,174 @@ def check_typo_against_dictionary(line_number: int, typo: str) -> None:
               f'on correctly spelled word "{word}".')
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]],
-                   trie: Dict[str, Any]) -> List[int]:
-  """Serializes trie and correction data in a form readable by the C code.
+def leaf_correction(leaf: Tuple[str, str]) -> Tuple[int, str]:
+  """Gets the backspaces and the string to type to correct a typo."""
+  typo, correction = leaf
+  word_boundary_ending = typo[-1] == ':'
+  typo = typo.strip(':')
+  i = 0
+  while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+    i += 1
+  backspaces = len(typo) - i - 1 + word_boundary_ending
+  assert 0 <= backspaces <= 63
+  return backspaces, correction[i:]
+
+
+def correction_keys(autocorrections: List[Tuple[str, str]]) -> Tuple[int, int]:
+  """Counts the keys sent to apply every correction once.
+
+  Returns:
+    Tuple of the keys sent, backspaces and characters, retyping only the tail
+    after the common prefix of the typo and correction, and retyping the
+    whole word.
+  """
+  tail_keys = 0
+  word_keys = 0
+  for typo, correction in autocorrections:
+    backspaces, tail = leaf_correction((typo, correction))
+    tail_keys += backspaces + len(tail)
+    word_keys += len(typo.strip(':')) - 1 + (typo[-1] == ':') + len(correction)
+  return tail_keys, word_keys
+
+
+def make_string_pool(strings: Iterable[str]) -> Tuple[List[int], Dict[str, int]]:
+  """Packs null-terminated strings, storing each suffix of another string as
+  the end of that string.
+
+  Returns:
+    Tuple of the pool as a list of bytes, and the offset of each string in it.
+  """
+  # Sorted by their reverse, a string that is a suffix of others is just before
+  # one of them.
+  strings = sorted(set(strings), key=lambda s: s[::-1])
+  pool = []
+  offsets = {}
+  for i in reversed(range(len(strings))):
+    s = strings[i]
+    if i + 1 < len(strings) and strings[i + 1].endswith(s):
+      longer = strings[i + 1]
+      offsets[s] = offsets[longer] + len(longer) - len(s)
+    else:
+      offsets[s] = len(pool)
+      pool += list(bytes(s, 'ascii')) + [0]
+  return pool, offsets
+
+
+def minimize_trie(states: List[Dict[str, Any]]) -> None:
+  """Merges equivalent states of the trie, as minimizing a trie into a DAWG.
+
+  Leaves are equivalent if they have the same correction, and other states if
+  they have the same failure depth and children on the same characters that
+  are equivalent. The keys after equivalent states then do the same, and the C
+  code's walk of the last keys from state 0 for a failure link may end in any
+  of them. Deepest first, each state's children are replaced by the first state
+  equivalent to each.
 
   Args:
-    autocorrections: List of (typo, correction) tuples.
-    trie: Dict of dicts.
+    states: List of states from make_automaton(), modified in place.
+  """
+  classes = {}
+  for state in sorted(states[1:], key=lambda state: -state['depth']):
+    if state['leaf']:
+      key = ('leaf',) + leaf_correction(state['leaf'])
+    else:
+      state['children'] = {c: classes[child['class']]
+                           for c, child in state['children'].items()}
+      key = ('node', state['fail']['depth'],
+             tuple(sorted((c, id(child))
+                          for c, child in state['children'].items())))
+    state['class'] = key
+    classes.setdefault(key, state)
+  states[0]['children'] = {c: classes[child['class']]
+                           for c, child in states[0]['children'].items()}
+
+
+def serialize_automaton(states: List[Dict[str, Any]]) -> List[int]:
+  """Serializes the automaton in a form readable by the C code.
+
+  The automaton is stored as its trie of typos, the goto transitions, with a
+  failure link for each state. States are in depth first order, each once
+  however many states link to it, so that the only child of a state can follow
+  it. A state is serialized as a first byte, then:
+
+  * Leaf, 192 plus the number of backspaces: a 2-byte link to the correction,
+    a null-terminated string in the string pool after the states.
+  * Other states, 32 times the failure depth plus the kind. The failure link
+    is stored as its depth, the length of the longest proper suffix of the
+    state's prefix that is also a typo prefix. The C code finds that state by
+    walking the last keys from state 0. A depth of 5 or more is stored as 5,
+    then a byte with the depth. The kind is the TYPO_CHAR_BITS bit of the
+    state's one transition, whose next state follows, 30 for a state with one
+    transition to a state stored before: the bit, then a 2-byte link to the
+    next state, or 31 for a state with several: a 32-bit bitmap with the bits
+    of their characters set, then a 2-byte link to each next state in bit
+    order.
+
+  Args:
+    states: List of states from make_automaton(), or minimize_trie().
   Returns:
     List of ints in the range 0-255.
   """
-  table = []
-
-  # Traverse trie in depth first order.
-  def traverse(trie_node: Dict[str, Any]) -> Dict[str, Any]:
-    if 'LEAF' in trie_node:  # Handle a leaf trie node.
-      typo, correction = trie_node['LEAF']
-      word_boundary_ending = typo[-1] == ':'
-      typo = typo.strip(':')
-      i = 0  # Make the autocorrection data for this entry and serialize it.
-      while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-        i += 1
-      backspaces = len(typo) - i - 1 + word_boundary_ending
-      assert 0 <= backspaces <= 63
-      correction = correction[i:]
-      data = [backspaces + 128] + list(bytes(correction, 'ascii')) + [0]
-
-      entry = {'data': data, 'links': [], 'byte_offset': 0}
-      table.append(entry)
-    elif len(trie_node) == 1:  # Handle trie node with a single child.
-      c, trie_node = next(iter(trie_node.items()))
-      entry = {'chars': c, 'byte_offset': 0}
-
-      # It's common for a trie to have long chains of single-child nodes. We
-      # find the whole chain so that we can serialize it more efficiently.
-      while len(trie_node) == 1 and 'LEAF' not in trie_node:
-        c, trie_node = next(iter(trie_node.items()))
-        entry['chars'] += c
-
-      table.append(entry)
-      entry['links'] = [traverse(trie_node)]
-    else:  # Handle trie node with multiple children.
-      entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
-      table.append(entry)
-      entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
-    return entry
-
-  traverse(trie)
-
-  def serialize(e: Dict[str, Any]) -> List[int]:
-    if not e['links']:  # Handle a leaf table entry.
-      return e['data']
-    elif len(e['links']) == 1:  # Handle a chain table entry.
-      return [TYPO_CHARS[c] for c in e['chars']] + [0]
-    else:  # Handle a branch table entry.
-      data = []
-      for c, link in zip(e['chars'], e['links']):
-        data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
-      return data + [0]
-
-  byte_offset = 0
-  for e in table:  # To encode links, first compute byte offset of each entry.
-    e['byte_offset'] = byte_offset
-    byte_offset += len(serialize(e))
-
-  return [b for e in table for b in serialize(e)]  # Serialize final table.
+  pool, pool_offsets = make_string_pool(
+      leaf_correction(state['leaf'])[1] for state in states if state['leaf'])
+
+  def children(state: Dict[str, Any]) -> List[Tuple[int, Dict[str, Any]]]:
+    return sorted(((TYPO_CHAR_BITS[c], child)
+                   for c, child in state['children'].items()),
+                  key=lambda link: link[0])
+
+  order = []
+  def visit(state: Dict[str, Any]) -> None:
+    state['index'] = len(order)
+    order.append(state)
+    for _, child in children(state):
+      if 'index' not in child:
+        visit(child)
+  for state in states:
+    state.pop('index', None)
+  visit(states[0])
+
+  def serialize(state: Dict[str, Any]) -> List[int]:
+    if state['leaf']:  # Handle a leaf state.
+      backspaces, correction = leaf_correction(state['leaf'])
+      return [backspaces + 192] + encode_link(
+          {'byte_offset': pool_start + pool_offsets[correction]})
+    fail_depth = state['fail']['depth']
+    data = [min(fail_depth, 5) * 32] + ([fail_depth] if fail_depth >= 5 else [])
+    links = children(state)
+    if len(links) == 1:  # Handle a state with one transition.
+      bit, child = links[0]
+      if child['index'] == state['index'] + 1:
+        data[0] += bit
+        return data
+      data[0] += 30
+      return data + [bit] + encode_link(child)
+    # Handle a state with several transitions.
+    bitmap = 0
+    for bit, _ in links:
+      bitmap |= 1 << bit
+    data[0] += 31
+    data += [(bitmap >> shift) & 255 for shift in (0, 8, 16, 24)]
+    for _, child in links:
+      data += encode_link(child)
+    return data
+
+  pool_start = 0
+  for state in order:
+    state['byte_offset'] = 0
+  for state in order:  # To encode links, first compute byte offset of each.
+    state['byte_offset'] = pool_start
+    pool_start += len(serialize(state))
+
+  # Serialize final table.
+  return [b for state in order for b in serialize(state)] + pool
 
 
 def encode_link(link: Dict[str, Any]) -> List[int]:
   """Encodes a node link as two bytes."""
   byte_offset = link['byte_offset']
   if not (0 <= byte_offset <= 0xffff):
-    print('Error: The autocorrection table is too large, a node link exceeds '
+    print('Error: The autocorrection table is too large, a state link exceeds '
           '64KB limit. Try reducing the autocorrection dict to fewer entries.')
     sys.exit(1)
   return [byte_offset & 255, byte_offset >> 8]
@@ -304,10 +450,16 @@ def main(argv):
   h_file = argv[2] if len(argv) > 2 else get_default_h_file(dict_file)
 
   autocorrections = parse_file(dict_file)
-  trie = make_trie(autocorrections)
-  data = serialize_trie(autocorrections, trie)
-  print(f'Processed %d autocorrection entries to table with %d bytes.'
-        % (len(autocorrections), len(data)))
+  states = make_automaton(autocorrections)
+  unmerged_size = len(serialize_automaton(states))
+  minimize_trie(states)
+  data = serialize_automaton(states)
+  print(f'Processed %d autocorrection entries to table with %d bytes, from %d '
+        'bytes before merging states.'
+        % (len(autocorrections), len(data), unmerged_size))
+  tail_keys, word_keys = correction_keys(autocorrections)
+  print(f'Corrections send %.1f keys on average, %.1f to retype the whole word.'
+        % (tail_keys / len(autocorrections), word_keys / len(autocorrections)))
   write_generated_code(autocorrections, data, h_file)
 
 
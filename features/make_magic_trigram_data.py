@@ -0,0 +1,237 @@
+# Copyright 2026 Artur Gomes
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Python program to make magic_trigram_data.h.
+
+This program reads "magic_trigram_dict.txt" from the current directory and
+generates a C source file "magic_trigram_data.h" with a perfect hash table of
+the completions. Run this program without arguments like
+
+$ python3 make_magic_trigram_data.py
+
+Or specify the dict file and optionally the output .h file like
+
+$ python3 make_magic_trigram_data.py dict.txt somewhere/out.h
+
+Each line of the dict file defines a context of two or three keys and the
+text that the magic key types after it, with the syntax "context -> text".
+Contexts have letters a-z and ':' for a word break. Texts have letters a-z.
+Blank lines or lines starting with '#' are ignored. Example:
+
+    :th -> at
+    :sh -> ould
+    ti  -> on
+
+See features/magic_trigrams.h for how the table is used.
+"""
+
+import os.path
+import sys
+import textwrap
+from typing import Dict, Iterator, List, Optional, Tuple
+
+# 5-bit codes of context characters, as in magic_trigrams.c. 0 is no key.
+CONTEXT_CODES = dict(
+  [(chr(c), c - ord('a') + 1) for c in range(ord('a'), ord('z') + 1)] +
+  [(':', 27)]
+)
+
+MAX_SEED = 0xffff
+MAX_DISPLACEMENT = 0xff
+
+
+def parse_file_lines(file_name: str) -> Iterator[Tuple[int, str, str]]:
+  """Parses lines read from `file_name` into context-text pairs."""
+
+  line_number = 0
+  for line in open(file_name, 'rt'):
+    line_number += 1
+    line = line.strip()
+    if line and line[0] != '#':
+      # Parse syntax "context -> text", using strip to ignore indenting.
+      tokens = [token.strip() for token in line.split('->', 1)]
+      if len(tokens) != 2 or not tokens[0] or not tokens[1]:
+        print(f'Error:{line_number}: Invalid syntax: "{line}"')
+        sys.exit(1)
+      yield line_number, tokens[0].lower(), tokens[1]
+
+
+def parse_file(file_name: str) -> List[Tuple[str, str]]:
+  """Parses and validates the dictionary file.
+
+  Args:
+    file_name: String, path of the dictionary.
+  Returns:
+    List of (context, text) tuples.
+  """
+  entries = []
+  contexts = set()
+  for line_number, context, text in parse_file_lines(file_name):
+    if context in contexts:
+      print(f'Warning:{line_number}: Ignoring duplicate context: "{context}"')
+      continue
+    if not (2 <= len(context) <= 3 and
+            all(c in CONTEXT_CODES for c in context) and ':' not in context[1:]):
+      print(f'Error:{line_number}: Context "{context}" must be two or three '
+            "of a-z, with ':' only first")
+      sys.exit(1)
+    if not all('a' <= c <= 'z' for c in text):
+      print(f'Error:{line_number}: Text "{text}" has characters other than a-z')
+      sys.exit(1)
+
+    entries.append((context, text))
+    contexts.add(context)
+
+  return entries
+
+
+def context_key(context: str) -> int:
+  """Packs a context into 15 bits, oldest key in the high bits."""
+  key = 0
+  for c in context:
+    key = key << 5 | CONTEXT_CODES[c]
+  return key
+
+
+def hash_bucket(key: int, seed: int, num_buckets: int) -> int:
+  h = ((key ^ seed) * 0x9E3779B1) & 0xffffffff
+  return ((h >> 16) * num_buckets) >> 16
+
+
+def hash_slot(key: int, seed: int, displacement: int, num_slots: int) -> int:
+  h = (((key ^ seed) * 0x85EBCA6B) & 0xffffffff) >> 16
+  return (((h ^ (displacement * 0x9E37)) & 0xffff) * num_slots) >> 16
+
+
+def make_perfect_hash(keys: List[int], num_buckets: int, num_slots: int,
+                      seed: int) -> Optional[List[int]]:
+  """Finds each bucket's displacement so that no two keys share a slot.
+
+  Buckets are placed largest first, each with the first displacement that
+  sends all of its keys to free slots.
+
+  Returns:
+    List of displacements, or None if some bucket has none that fits.
+  """
+  buckets = [[] for _ in range(num_buckets)]
+  for key in keys:
+    buckets[hash_bucket(key, seed, num_buckets)].append(key)
+
+  displacements = [0] * num_buckets
+  used = [False] * num_slots
+  for b in sorted(range(num_buckets), key=lambda b: -len(buckets[b])):
+    if not buckets[b]:
+      break
+    for d in range(MAX_DISPLACEMENT + 1):
+      slots = [hash_slot(key, seed, d, num_slots) for key in buckets[b]]
+      if len(set(slots)) == len(slots) and not any(used[s] for s in slots):
+        for s in slots:
+          used[s] = True
+        displacements[b] = d
+        break
+    else:
+      return None
+
+  return displacements
+
+
+def make_string_pool(texts: List[str]) -> Tuple[str, Dict[str, int]]:
+  """Packs NUL-terminated texts, sharing texts that are suffixes of others."""
+  pool = ''
+  offsets = {}
+  for text in sorted(set(texts), key=len, reverse=True):
+    i = pool.find(text + '\0')
+    if i < 0:
+      i = len(pool)
+      pool += text + '\0'
+    offsets[text] = i
+  return pool, offsets
+
+
+def write_generated_code(entries: List[Tuple[str, str]], file_name: str) -> int:
+  """Writes the hash table as generated C code to `file_name`.
+
+  Returns:
+    Size of the table in bytes.
+  """
+  keys = [context_key(context) for context, _ in entries]
+  num_buckets = max(1, (len(keys) + 2) // 3)
+  num_slots = len(keys) + len(keys) // 16 + 1
+
+  for seed in range(MAX_SEED + 1):
+    displacements = make_perfect_hash(keys, num_buckets, num_slots, seed)
+    if displacements is not None:
+      break
+  else:
+    print('Error: Found no perfect hash for the dictionary.')
+    sys.exit(1)
+
+  pool, offsets = make_string_pool([text for _, text in entries])
+  if len(pool) > 0xffff:
+    print('Error: The completion texts exceed the 64KB limit.')
+    sys.exit(1)
+
+  slot_keys = [0] * num_slots
+  slot_offsets = [0] * num_slots
+  for key, (_, text) in zip(keys, entries):
+    slot = hash_slot(key, seed, displacements[hash_bucket(
+        key, seed, num_buckets)], num_slots)
+    slot_keys[slot] = key
+    slot_offsets[slot] = offsets[text]
+
+  def array(c_type: str, name: str, values: List[int]) -> str:
+    return textwrap.fill('static const %s %s[%d] PROGMEM = {%s};' % (
+        c_type, name, len(values), ', '.join(map(str, values))),
+        width=80, subsequent_indent='  ') + '\n\n'
+
+  max_context = max(len(context) for context, _ in entries)
+  generated_code = ''.join([
+    '// Generated code.\n\n',
+    f'// Magic trigram dictionary ({len(entries)} entries):\n',
+    ''.join(sorted(f'//   {context:<{max_context}} -> {text}\n'
+                   for context, text in entries)),
+    f'\n#define MAGIC_TRIGRAM_SEED {seed}\n',
+    f'#define MAGIC_TRIGRAM_NUM_BUCKETS {num_buckets}\n',
+    f'#define MAGIC_TRIGRAM_NUM_SLOTS {num_slots}\n\n',
+    array('uint8_t', 'magic_trigram_displacements', displacements),
+    array('uint16_t', 'magic_trigram_keys', slot_keys),
+    array('uint16_t', 'magic_trigram_offsets', slot_offsets),
+    array('char', 'magic_trigram_texts', [ord(c) for c in pool]),
+  ])
+
+  with open(file_name, 'wt') as f:
+    f.write(generated_code)
+
+  return num_buckets + 4 * num_slots + len(pool)
+
+
+def get_default_h_file(dict_file: str) -> str:
+  return os.path.join(os.path.dirname(dict_file), 'magic_trigram_data.h')
+
+
+def main(argv):
+  dict_file = argv[1] if len(argv) > 1 else 'magic_trigram_dict.txt'
+  h_file = argv[2] if len(argv) > 2 else get_default_h_file(dict_file)
+
+  entries = parse_file(dict_file)
+  if not entries:
+    print('Error: The dictionary is empty.')
+    sys.exit(1)
+  size = write_generated_code(entries, h_file)
+  print(f'Processed {len(entries)} magic trigram entries to table with '
+        f'{size} bytes.')
+
+
+if __name__ == '__main__':
+  main(sys.argv)
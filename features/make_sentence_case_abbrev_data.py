@@ -0,0 +1,193 @@
+# Copyright 2026 Artur Gomes
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Python program to make sentence_case_abbrev_data.h.
+
+This program reads "sentence_case_abbrev_dict.txt" from the current directory
+and generates a C source file "sentence_case_abbrev_data.h" with a trie of the
+abbreviations, keyed on their keys from last to first. Run this program
+without arguments like
+
+$ python3 make_sentence_case_abbrev_data.py
+
+Or specify the dict file and optionally the output .h file like
+
+$ python3 make_sentence_case_abbrev_data.py dict.txt somewhere/out.h
+
+Each line of the dict file is an abbreviation of letters a-z and '.', ending
+in '.'. Blank lines or lines starting with '#' are ignored. Example:
+
+    e.g.
+    etc.
+    approx.
+
+The trie is serialized as nodes, each a list of 3-byte entries terminated by a
+0 byte. An entry is the keycode of the key before, then the 16-bit offset of
+the node for the keys before that, low byte first. KC_SPC is a word break
+before the abbreviation, and its offset is 0. The root node is at offset 0.
+See sentence_case_check_ending() in features/sentence_case.c for how the trie
+is walked.
+"""
+
+import os.path
+import sys
+import textwrap
+from typing import Any, Dict, Iterator, List, Tuple
+
+# Keycodes of abbreviation characters. ' ' is the word break before one.
+KEYCODES = dict(
+  [(chr(c), c - ord('a') + 0x04) for c in range(ord('a'), ord('z') + 1)] +
+  [('.', 0x37), (' ', 0x2c)]
+)
+
+# The key buffer holds the abbreviation and the word break before it, and is
+# at most 127 keys long.
+MAX_ABBREV_LENGTH = 126
+
+Trie = Dict[str, Any]
+
+
+def parse_file_lines(file_name: str) -> Iterator[Tuple[int, str]]:
+  """Parses lines read from `file_name` into abbreviations."""
+
+  line_number = 0
+  for line in open(file_name, 'rt'):
+    line_number += 1
+    line = line.strip()
+    if line and line[0] != '#':
+      yield line_number, line.lower()
+
+
+def parse_file(file_name: str) -> List[str]:
+  """Parses and validates the dictionary file.
+
+  Args:
+    file_name: String, path of the dictionary.
+  Returns:
+    List of abbreviations.
+  """
+  abbrevs = []
+  for line_number, abbrev in parse_file_lines(file_name):
+    if abbrev in abbrevs:
+      print(f'Warning:{line_number}: Ignoring duplicate abbreviation: '
+            f'"{abbrev}"')
+      continue
+    if not (all(c in KEYCODES and c != ' ' for c in abbrev) and
+            len(abbrev) >= 2 and abbrev[-1] == '.'):
+      print(f'Error:{line_number}: Abbreviation "{abbrev}" must be letters a-z '
+            "and '.', ending in '.'")
+      sys.exit(1)
+    if len(abbrev) > MAX_ABBREV_LENGTH:
+      print(f'Error:{line_number}: Abbreviation "{abbrev}" exceeds '
+            f'{MAX_ABBREV_LENGTH} characters')
+      sys.exit(1)
+
+    abbrevs.append(abbrev)
+
+  return abbrevs
+
+
+def make_trie(abbrevs: List[str]) -> Trie:
+  """Makes a trie of the abbreviations from last to first character.
+
+  Each abbreviation is followed by ' ' for the word break before it, which is
+  a leaf.
+  """
+  trie = {}
+  for abbrev in abbrevs:
+    node = trie
+    for c in reversed(' ' + abbrev):
+      node = node.setdefault(c, {})
+  return trie
+
+
+def node_key(node: Trie) -> Tuple:
+  """Key that is equal for nodes with equal subtrees."""
+  return tuple((c, node_key(child)) for c, child in sorted(node.items()))
+
+
+def serialize_trie(trie: Trie) -> List[int]:
+  """Serializes the trie, nodes in breadth-first order from the root.
+
+  Equal subtrees, like the many abbreviations that start after a word break
+  with the same letter, are serialized once and shared.
+  """
+  nodes = [trie]
+  offsets = {node_key(trie): 0}
+  size = 3 * len(trie) + 1
+  i = 0
+  while i < len(nodes):
+    for c, child in sorted(nodes[i].items()):
+      key = node_key(child)
+      if c != ' ' and key not in offsets:
+        offsets[key] = size
+        size += 3 * len(child) + 1
+        nodes.append(child)
+    i += 1
+  if size > 0xffff:
+    print('Error: The trie exceeds the 64KB limit.')
+    sys.exit(1)
+
+  data = []
+  for node in nodes:
+    for c, child in sorted(node.items()):
+      offset = 0 if c == ' ' else offsets[node_key(child)]
+      data += [KEYCODES[c], offset & 0xff, offset >> 8]
+    data.append(0)
+  return data
+
+
+def write_generated_code(abbrevs: List[str], file_name: str) -> int:
+  """Writes the trie as generated C code to `file_name`.
+
+  Returns:
+    Size of the trie in bytes.
+  """
+  data = serialize_trie(make_trie(abbrevs))
+  max_length = max(len(abbrev) for abbrev in abbrevs)
+  generated_code = ''.join([
+    '// Generated code.\n\n',
+    f'// Sentence Case abbreviations ({len(abbrevs)} entries):\n',
+    ''.join(f'//   {abbrev}\n' for abbrev in sorted(abbrevs)),
+    f'\n#define SENTENCE_CASE_ABBREV_MAX_LENGTH {max_length}\n\n',
+    textwrap.fill('static const uint8_t sentence_case_abbrev_data[%d] '
+                  'PROGMEM = {%s};' % (len(data), ', '.join(map(str, data))),
+                  width=80, subsequent_indent='  '),
+    '\n',
+  ])
+
+  with open(file_name, 'wt') as f:
+    f.write(generated_code)
+
+  return len(data)
+
+
+def get_default_h_file(dict_file: str) -> str:
+  return os.path.join(os.path.dirname(dict_file), 'sentence_case_abbrev_data.h')
+
+
+def main(argv):
+  dict_file = argv[1] if len(argv) > 1 else 'sentence_case_abbrev_dict.txt'
+  h_file = argv[2] if len(argv) > 2 else get_default_h_file(dict_file)
+
+  abbrevs = parse_file(dict_file)
+  if not abbrevs:
+    print('Error: The dictionary is empty.')
+    sys.exit(1)
+  size = write_generated_code(abbrevs, h_file)
+  print(f'Processed {len(abbrevs)} abbreviations to trie with {size} bytes.')
+
+
+if __name__ == '__main__':
+  main(sys.argv)
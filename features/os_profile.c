@@ -0,0 +1,75 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file os_profile.c
+ * @brief OS Profile implementation
+ */
+
+#include "features/os_profile.h"
+
+// Windows and Linux: Home, Shift+End. Mac: GUI+Left, Shift+GUI+Right.
+static const char pc_select_line[] PROGMEM =
+    SS_TAP(X_HOME) SS_LSFT(SS_TAP(X_END));
+static const char mac_select_line[] PROGMEM =
+    SS_LGUI(SS_TAP(X_LEFT) SS_LSFT(SS_TAP(X_RGHT)));
+
+static const char pc_select_to_line_end[] PROGMEM = SS_LSFT(SS_TAP(X_END));
+static const char mac_select_to_line_end[] PROGMEM =
+    SS_LGUI(SS_LSFT(SS_TAP(X_RGHT)));
+
+// Copy, new tab, paste, Enter.
+static const char pc_search_selection[] PROGMEM =
+    SS_LCTL("ct") SS_DELAY(100) SS_LCTL("v") SS_TAP(X_ENTER);
+static const char mac_search_selection[] PROGMEM =
+    SS_LGUI("ct") SS_DELAY(100) SS_LGUI("v") SS_TAP(X_ENTER);
+
+#define PC_PROFILE(mode)                         \
+  {                                              \
+    .word_mod = KC_LCTL,                         \
+    .unicode_mode = (mode),                      \
+    .select_line = pc_select_line,               \
+    .select_to_line_end = pc_select_to_line_end, \
+    .search_selection = pc_search_selection,     \
+  }
+
+#define MAC_PROFILE                               \
+  {                                               \
+    .word_mod = KC_LALT,                          \
+    .unicode_mode = UNICODE_MODE_MACOS,           \
+    .select_line = mac_select_line,               \
+    .select_to_line_end = mac_select_to_line_end, \
+    .search_selection = mac_search_selection,     \
+  }
+
+// Indexed by os_variant_t. Unknown hosts get the Windows/Linux hotkeys.
+static const os_profile_t profiles[] = {
+    [OS_UNSURE] = PC_PROFILE(UNICODE_MODE_LINUX),
+    [OS_LINUX] = PC_PROFILE(UNICODE_MODE_LINUX),
+    [OS_WINDOWS] = PC_PROFILE(UNICODE_MODE_WINCOMPOSE),
+    [OS_MACOS] = MAC_PROFILE,
+    [OS_IOS] = MAC_PROFILE,
+};
+
+const os_profile_t* os_profile = &profiles[OS_UNSURE];
+
+void os_profile_select(os_variant_t os) {
+  if ((uint8_t)os >= sizeof(profiles) / sizeof(*profiles)) {
+    os = OS_UNSURE;
+  }
+  os_profile = &profiles[os];
+  if (os != OS_UNSURE) {
+    set_unicode_input_mode(os_profile->unicode_mode);
+  }
+}
@@ -0,0 +1,72 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file os_profile.h
+ * @brief OS Profile - host-specific hotkeys, chosen once per host
+ *
+ * Overview
+ * --------
+ *
+ * Word navigation, line selection and a few shortcuts use different hotkeys
+ * on Mac than on Windows and Linux. Rather than asking OS Detection on every
+ * key event, the hotkeys for each host OS are gathered in a profile, and the
+ * profile is chosen once when OS Detection settles. Keys then read it through
+ * the `os_profile` pointer:
+ *
+ *     register_code(os_profile->word_mod);
+ *     send_string_P(os_profile->search_selection);
+ *
+ * Choose the profile from the OS Detection callback in keymap.c. It also sets
+ * the Unicode input mode of the host:
+ *
+ *     bool process_detected_host_os_user(os_variant_t detected_os) {
+ *       os_profile_select(detected_os);
+ *       return true;
+ *     }
+ *
+ * Until then, `os_profile` points to the Windows/Linux profile.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Hotkeys and settings for one host OS. */
+typedef struct {
+  /** Modifier keycode for word-wise moves: Alt on Mac, Ctrl otherwise. */
+  uint8_t word_mod;
+  /** Unicode input mode, applied when the profile is selected. */
+  uint8_t unicode_mode;
+  /** Selects the current line (PROGMEM string for `send_string_P()`). */
+  const char* select_line;
+  /** Extends the selection to the end of the line. */
+  const char* select_to_line_end;
+  /** Copies the selection and pastes it into a search in a new tab. */
+  const char* search_selection;
+} os_profile_t;
+
+/** Profile of the host OS. Never NULL. */
+extern const os_profile_t* os_profile;
+
+/** Selects the profile for `os`, and sets its Unicode input mode. */
+void os_profile_select(os_variant_t os);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,253 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file output_queue.c
+ * @brief Output Queue implementation
+ */
+
+#include "features/output_queue.h"
+
+// Number of queue entries. A tap takes one entry, so a full queue holds a
+// 64-character string. Must be a power of two.
+#ifndef OUTPUT_QUEUE_SIZE
+#define OUTPUT_QUEUE_SIZE 64
+#endif  // OUTPUT_QUEUE_SIZE
+
+// Minimum time in ms between reports sent from the queue. The default of 1 ms
+// is one full-speed USB frame.
+#ifndef OUTPUT_QUEUE_INTERVAL
+#define OUTPUT_QUEUE_INTERVAL 1
+#endif  // OUTPUT_QUEUE_INTERVAL
+
+#if OUTPUT_QUEUE_SIZE < 2 || OUTPUT_QUEUE_SIZE > 128 || \
+    (OUTPUT_QUEUE_SIZE & (OUTPUT_QUEUE_SIZE - 1)) != 0
+#error "output_queue: OUTPUT_QUEUE_SIZE must be a power of two from 2 to 128"
+#endif
+
+enum {
+  OP_TAP,        /**< Press `keycode` with weak `mods`, then release. */
+  OP_DOWN,       /**< Press `keycode`. */
+  OP_UP,         /**< Release `keycode`. */
+  OP_ADD_MODS,   /**< Register `mods`. */
+  OP_DEL_MODS,   /**< Unregister `mods`. */
+  OP_DELAY,      /**< Wait `mods << 8 | keycode` ms before the next entry. */
+};
+
+typedef struct {
+  uint8_t op;
+  uint8_t mods;
+  uint8_t keycode;
+} queue_entry_t;
+
+static queue_entry_t queue[OUTPUT_QUEUE_SIZE];
+static uint8_t head = 0;
+static uint8_t count = 0;
+// Whether the OP_TAP entry at `head` has been pressed but not released.
+static bool tap_pressed = false;
+// Time at which the next entry may be sent.
+static uint16_t next_time = 0;
+static output_queue_stats_t stats = {0};
+
+// Sends the report for the entry at `head`, popping the entry when it is done.
+// Returns the number of ms to wait before the next step.
+static uint16_t step(void) {
+  const queue_entry_t* entry = &queue[head];
+  // Weak mods may belong to the key being handled (e.g. Caps Word shifting a
+  // letter). Set them aside so that they don't leak into queued output.
+  const uint8_t saved_weak_mods = get_weak_mods();
+  uint16_t delay = OUTPUT_QUEUE_INTERVAL;
+
+  switch (entry->op) {
+    case OP_TAP:
+      if (!tap_pressed) {
+        set_weak_mods(entry->mods);
+        register_code(entry->keycode);
+        set_weak_mods(saved_weak_mods);
+        tap_pressed = true;
+        return delay;  // Release in the next step.
+      }
+      // Release the key and its mods in the same report.
+      clear_weak_mods();
+      unregister_code(entry->keycode);
+      tap_pressed = false;
+      break;
+
+    case OP_DOWN:
+      clear_weak_mods();
+      register_code(entry->keycode);
+      break;
+
+    case OP_UP:
+      clear_weak_mods();
+      unregister_code(entry->keycode);
+      break;
+
+    case OP_ADD_MODS:
+      clear_weak_mods();
+      register_mods(entry->mods);
+      break;
+
+    case OP_DEL_MODS:
+      clear_weak_mods();
+      unregister_mods(entry->mods);
+      break;
+
+    case OP_DELAY:
+      delay = (uint16_t)entry->mods << 8 | entry->keycode;
+      break;
+  }
+
+  set_weak_mods(saved_weak_mods);
+  head = (head + 1) & (OUTPUT_QUEUE_SIZE - 1);
+  --count;
+  return delay;
+}
+
+void output_queue_flush(void) {
+  if (!count) {
+    return;
+  }
+
+  const uint16_t start_time = timer_read();
+  if (!timer_expired(start_time, next_time)) {
+    wait_ms(next_time - start_time);
+  }
+  for (;;) {
+    const uint16_t delay = step();
+    if (!count) {
+      next_time = timer_read() + delay;
+      break;
+    }
+    wait_ms(delay);
+  }
+
+  const uint16_t stall = timer_elapsed(start_time);
+  if (stall > stats.longest_stall_ms) {
+    stats.longest_stall_ms = stall;
+  }
+  ++stats.flushes;
+}
+
+static void enqueue(uint8_t op, uint8_t mods, uint8_t keycode) {
+  if (count == OUTPUT_QUEUE_SIZE) {
+    output_queue_flush();  // Full; make room by sending everything now.
+  }
+  queue_entry_t* entry = &queue[(head + count) & (OUTPUT_QUEUE_SIZE - 1)];
+  entry->op = op;
+  entry->mods = mods;
+  entry->keycode = keycode;
+  if (++count > stats.max_depth) {
+    stats.max_depth = count;
+  }
+}
+
+bool process_output_queue(uint16_t keycode, keyrecord_t* record) {
+  // A release sends nothing that could overtake queued output, unless it
+  // releases a mod that queued taps would otherwise still see.
+  if (record->event.pressed || (get_mods() | get_oneshot_mods())) {
+    output_queue_flush();
+  }
+  return true;
+}
+
+void output_queue_task(void) {
+  if (timer_expired(timer_read(), next_time)) {
+    // While idle, keep next_time current so that it never falls more than the
+    // 16-bit timer's half range behind and seems to be in the future.
+    next_time = timer_read() + (count ? step() : 0);
+  }
+}
+
+void output_queue_tap_code(uint8_t keycode) { enqueue(OP_TAP, 0, keycode); }
+
+void output_queue_tap_code16(uint16_t keycode) {
+  uint8_t mods = 0;
+  if (IS_QK_MODS(keycode)) {
+    // Convert 5-bit keycode mods to the 8-bit mods of the HID report.
+    mods = QK_MODS_GET_MODS(keycode);
+    if (mods & 0x10) {
+      mods = (mods & 0x0f) << 4;
+    }
+  }
+  enqueue(OP_TAP, mods, QK_MODS_GET_BASIC_KEYCODE(keycode));
+}
+
+void output_queue_register_mods(uint8_t mods) {
+  enqueue(OP_ADD_MODS, mods, 0);
+}
+
+void output_queue_unregister_mods(uint8_t mods) {
+  enqueue(OP_DEL_MODS, mods, 0);
+}
+
+void output_queue_send_char(char c) {
+  const uint8_t i = (uint8_t)c & 0x7f;
+  const uint8_t mods =
+      (PGM_LOADBIT(ascii_to_shift_lut, i) ? MOD_BIT(KC_LSFT) : 0) |
+      (PGM_LOADBIT(ascii_to_altgr_lut, i) ? MOD_BIT(KC_RALT) : 0);
+  enqueue(OP_TAP, mods, pgm_read_byte(&ascii_to_keycode_lut[i]));
+}
+
+void output_queue_delay(uint16_t ms) { enqueue(OP_DELAY, ms >> 8, ms & 0xff); }
+
+// Reads the character at `string`, in RAM or, if `progmem`, in PROGMEM.
+static char read_char(const char* string, bool progmem) {
+  return progmem ? pgm_read_byte(string) : *string;
+}
+
+// Queues a string in the format of `send_string()` or `send_string_P()`.
+static void queue_string(const char* string, bool progmem) {
+  for (;; ++string) {
+    char c = read_char(string, progmem);
+    if (!c) {
+      break;
+    }
+
+    if (c == SS_QMK_PREFIX) {
+      c = read_char(++string, progmem);
+      if (c == SS_TAP_CODE) {
+        enqueue(OP_TAP, 0, read_char(++string, progmem));
+      } else if (c == SS_DOWN_CODE) {
+        enqueue(OP_DOWN, 0, read_char(++string, progmem));
+      } else if (c == SS_UP_CODE) {
+        enqueue(OP_UP, 0, read_char(++string, progmem));
+      } else if (c == SS_DELAY_CODE) {
+        // Parse the decimal delay, which is terminated by a '|'.
+        uint16_t ms = 0;
+        for (c = read_char(++string, progmem); '0' <= c && c <= '9';
+             c = read_char(++string, progmem)) {
+          ms = ms * 10 + (c - '0');
+        }
+        output_queue_delay(ms);
+      }
+      continue;
+    }
+
+    output_queue_send_char(c);
+  }
+}
+
+void output_queue_send_string(const char* string) {
+  queue_string(string, false);
+}
+
+void output_queue_send_string_P(const char* string) {
+  queue_string(string, true);
+}
+
+output_queue_stats_t output_queue_get_stats(void) {
+  stats.depth = count;
+  return stats;
+}
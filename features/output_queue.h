@@ -0,0 +1,133 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file output_queue.h
+ * @brief Output Queue - non-blocking macro output
+ *
+ * Overview
+ * --------
+ *
+ * QMK's `SEND_STRING()` and `tap_code()` block until the whole macro has been
+ * typed, waiting `TAP_CODE_DELAY` ms per key. Meanwhile the matrix is not
+ * scanned and housekeeping, RGB and OLED tasks stall.
+ *
+ * This library instead appends macro output to a ring buffer and returns
+ * immediately. `output_queue_task()`, called from housekeeping, drains the
+ * queue sending at most one HID report every `OUTPUT_QUEUE_INTERVAL` ms (one
+ * USB frame by default), so a 20-character string costs 40 short housekeeping
+ * steps rather than a 200 ms stall.
+ *
+ * Output stays in order with later keys by blocking: if a key press arrives
+ * while the queue is not empty, `process_output_queue()` sends the rest of the
+ * queue, waiting between reports, before that press is handled. Releases
+ * don't wait unless mods are held, so the release of the macro key itself
+ * lets the queue drain in the background. Mods applied through the queue
+ * therefore see the same state as they would with the blocking functions.
+ *
+ * Call `process_output_queue()` first thing in `process_record_user()`:
+ *
+ *     #include "features/output_queue.h"
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       if (!process_output_queue(keycode, record)) { return false; }
+ *       // Your macros ...
+ *       switch (keycode) {
+ *         case UPDIR:
+ *           if (record->event.pressed) {
+ *             QUEUE_STRING("../");
+ *           }
+ *           return false;
+ *       }
+ *       return true;
+ *     }
+ *
+ * and `output_queue_task()` from `housekeeping_task_user()`:
+ *
+ *     void housekeeping_task_user(void) {
+ *       output_queue_task();
+ *       // Other tasks ...
+ *     }
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Queues a string like `SEND_STRING()`, including SS_TAP(), SS_DELAY(), etc. */
+#define QUEUE_STRING(string) output_queue_send_string_P(PSTR(string))
+
+/** Counters describing how the queue has been used since power on. */
+typedef struct {
+  /** Number of entries currently queued. */
+  uint8_t depth;
+  /** Highest number of entries queued at once. */
+  uint8_t max_depth;
+  /**
+   * Longest time in ms that the queue blocked the main loop. This happens
+   * only when a key event arrives mid-drain or the queue overflows.
+   */
+  uint16_t longest_stall_ms;
+  /** Number of times the queue was drained synchronously. */
+  uint16_t flushes;
+} output_queue_stats_t;
+
+/**
+ * Handler function for Output Queue.
+ *
+ * Sends any queued output, blocking until done, before a key press or a
+ * release with mods held is handled. Always returns true.
+ */
+bool process_output_queue(uint16_t keycode, keyrecord_t* record);
+
+/** Sends the next queued report when due. Call from housekeeping. */
+void output_queue_task(void);
+
+/** Queues a tap of a basic keycode, like `tap_code()`. */
+void output_queue_tap_code(uint8_t keycode);
+
+/** Queues a tap of a basic keycode with mods, e.g. `C(KC_B)`. */
+void output_queue_tap_code16(uint16_t keycode);
+
+/** Queues holding mods down, like `register_mods()`. */
+void output_queue_register_mods(uint8_t mods);
+
+/** Queues releasing mods, like `unregister_mods()`. */
+void output_queue_unregister_mods(uint8_t mods);
+
+/** Queues typing an ASCII character, like `send_char()`. */
+void output_queue_send_char(char c);
+
+/** Queues a pause of `ms` milliseconds before the next entry is sent. */
+void output_queue_delay(uint16_t ms);
+
+/** Queues a string in the format of `send_string()`. */
+void output_queue_send_string(const char* string);
+
+/** Queues a PROGMEM string in the format of `send_string_P()`. */
+void output_queue_send_string_P(const char* string);
+
+/** Sends all queued output now, blocking until done. */
+void output_queue_flush(void);
+
+/** Gets the queue's counters. */
+output_queue_stats_t output_queue_get_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -21,6 +21,7 @@
  */
 
 #include "select_word.h"
+#include "features/os_profile.h"
 
 #if !defined(IS_QK_MOD_TAP)
 // Attempt to detect out-of-date QMK installation, which would fail with
@@ -33,43 +34,8 @@ static int8_t selection_dir = 0;
 static bool reset_before_next_event = false;
 static uint8_t registered_hotkey = KC_NO;
 
-// Macro `IS_MAC` determines whether to use Mac vs. Windows/Linux hotkeys:
-//
-// * OS Detection is used if it is enabled.
-//
-// * With SELECT_WORD_OS_DYNAMIC, the user may define callback
-//   select_word_host_is_mac().
-//
-// * Otherwise, the assumed OS is set at compile time, to Window/Linux by
-//   default, or to Mac with SELECT_WORD_OS_MAC.
-#if defined(SELECT_WORD_OS_DYNAMIC) || defined(OS_DETECTION_ENABLE)
-__attribute__((weak)) bool select_word_host_is_mac(void) {
-#  ifdef OS_DETECTION_ENABLE  // Use OS Detection if enabled.
-  switch (detected_host_os()) {
-    case OS_LINUX:
-    case OS_WINDOWS:
-      return false;
-    case OS_MACOS:
-    case OS_IOS:
-      return true;
-    default:
-      break;
-  }
-#  endif  // OS_DETECTION_ENABLE
-#  ifdef SELECT_WORD_OS_MAC
-  return true;
-#  else
-  return false;
-#  endif  // SELECT_WORD_OS_MAC
-}
-#  define IS_MAC select_word_host_is_mac()
-#else
-#  ifdef SELECT_WORD_OS_MAC
-#  define IS_MAC true
-#  else
-#  define IS_MAC false
-#  endif  // SELECT_WORD_OS_MAC
-#endif  // defined(SELECT_WORD_OS_DYNAMIC) || defined(OS_DETECTION_ENABLE)
+// Mac vs. Windows/Linux hotkeys come from the OS profile, chosen once when OS
+// Detection settles. See features/os_profile.h.
 
 // Idle timeout timer to reset Select Word after a period of inactivity.
 #if SELECT_WORD_TIMEOUT > 0
@@ -124,7 +90,7 @@ static void select_word_in_dir(int8_t dir) {
     tap_code_delay((dir < 0) ? KC_RGHT : KC_LEFT, TAP_CODE_DELAY);
   }
 
-  add_mods(IS_MAC ? MOD_BIT_LALT : MOD_BIT_LCTRL);
+  add_mods(MOD_BIT(os_profile->word_mod));
 
   if (selection_dir == 0) {  // Initial selection.
     send_keyboard_report();
@@ -158,10 +124,7 @@ static void select_line(void) {
 
   if (selection_dir != 2) {
     send_keyboard_report();
-    send_string_with_delay_P(
-        IS_MAC ? PSTR(SS_LGUI(SS_TAP(X_LEFT) SS_LSFT(SS_TAP(X_RGHT))))
-               : PSTR(SS_TAP(X_HOME) SS_LSFT(SS_TAP(X_END))),
-        TAP_CODE_DELAY);
+    send_string_with_delay_P(os_profile->select_line, TAP_CODE_DELAY);
   } else {
     register_mods(MOD_BIT_LSHIFT);
     registered_hotkey = KC_DOWN;
@@ -194,6 +157,10 @@ void select_word_register(char action) {
 #endif  // SELECT_WORD_TIMEOUT > 0
 }
 
+bool is_select_word_active(void) {
+  return selection_dir != 0;
+}
+
 void select_word_unregister(void) {
   reset_before_next_event = false;
   unregister_code(registered_hotkey);
@@ -205,10 +172,7 @@ void select_word_unregister(void) {
     const uint8_t saved_mods = get_mods();
     clear_all_mods();
     send_keyboard_report();
-    send_string_with_delay_P(
-        IS_MAC ? PSTR(SS_LGUI(SS_LSFT(SS_TAP(X_RGHT))))
-               : PSTR(SS_LSFT(SS_TAP(X_END))),
-        TAP_CODE_DELAY);
+    send_string_with_delay_P(os_profile->select_to_line_end, TAP_CODE_DELAY);
     set_mods(saved_mods);
   }
 
@@ -219,37 +183,28 @@ void select_word_unregister(void) {
 }
 
 bool process_select_word(uint16_t keycode, keyrecord_t* record) {
+  text_event_t event;
+  text_event_normalize(&event, keycode, record);
+  return process_select_word_event(&event, keycode, record);
+}
+
+bool process_select_word_event(const text_event_t* event, uint16_t keycode,
+                               keyrecord_t* record) {
   if (selection_dir) {
     if (reset_before_next_event) {
       selection_dir = 0;
     }
 
-    // Ignore most modifier and layer switch keys.
-    switch (keycode) {
-      case MODIFIER_KEYCODE_RANGE:
-      case QK_MOMENTARY ... QK_MOMENTARY_MAX:
-      case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
-      case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
-      case QK_TO ... QK_TO_MAX:
-      case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
-#ifndef NO_ACTION_ONESHOT
-      case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
-      case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
-#endif  // NO_ACTION_ONESHOT
+    // Ignore modifier and layer switch keys, Layer Lock, and hold events on
+    // mod-tap and layer-tap keys.
+    if (!event->is_tap) {
+      return true;
+    }
 #ifdef LAYER_LOCK_ENABLE
-      case QK_LLCK:
-#endif  // LAYER_LOCK_ENABLE
-        return true;
-#ifndef NO_ACTION_TAPPING
-      // Ignore hold events on mod-tap and layer-tap keys.
-      case QK_MOD_TAP ... QK_MOD_TAP_MAX:
-      case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
-        if (record->tap.count == 0) {
-          return true;
-        }
-        break;
-#endif  // NO_ACTION_TAPPING
+    if (keycode == QK_LLCK) {
+      return true;
     }
+#endif  // LAYER_LOCK_ENABLE
 
     reset_before_next_event = true;
   }
@@ -261,11 +216,7 @@ bool process_select_word(uint16_t keycode, keyrecord_t* record) {
 #endif  // SELECT_WORD_TIMEOUT > 0
 
   if (SELECT_WORD_KEYCODE && keycode == SELECT_WORD_KEYCODE) {
-    const bool shifted = MOD_MASK_SHIFT & (get_mods() | get_weak_mods()
-#ifndef NO_ACTION_ONESHOT
-       | get_oneshot_mods()
-#endif  // NO_ACTION_ONESHOT
-      );
+    const bool shifted = event->mods & MOD_MASK_SHIFT;
 
     if (record->event.pressed) {
       select_word_register(shifted ? 'L' : 'W');
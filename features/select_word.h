@@ -26,6 +26,9 @@
  * Pressing the button with shift selects the current line, and pressing the
  * button again extends the selection to the following line.
  *
+ * The hotkeys for Mac or Windows/Linux are those of the selected OS profile,
+ * see features/os_profile.h.
+ *
  * For full documentation, see
  * <https://getreuer.info/posts/keyboards/select-word>
  */
@@ -33,6 +36,7 @@
 #pragma once
 
 #include "quantum.h"
+#include "text_event.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -58,6 +62,13 @@ extern uint16_t SELECT_WORD_KEYCODE;
 /** Handler function for Select Word. */
 bool process_select_word(uint16_t keycode, keyrecord_t* record);
 
+/**
+ * Handler function for Select Word, given the event decoded by
+ * `text_event_normalize()` and the event's `keycode` as is.
+ */
+bool process_select_word_event(const text_event_t* event, uint16_t keycode,
+                               keyrecord_t* record);
+
 /**
  * @fn select_word_task(void)
  * Matrix task function for Select Word.
@@ -96,6 +107,13 @@ void select_word_register(char action);
 /** Unregisters (releases) selection hotkey. */
 void select_word_unregister(void);
 
+/**
+ * Gets whether a selection is in progress. While it is, any key event other
+ * than mods and layer switches ends the selection, so the event must reach
+ * `process_select_word()`.
+ */
+bool is_select_word_active(void);
+
 /** Registers and unregisters ("taps") selection `action.` */
 static inline void select_word_tap(char action) {
   select_word_register(action);
@@ -103,23 +121,6 @@ static inline void select_word_tap(char action) {
   select_word_unregister();
 }
 
-#if defined(SELECT_WORD_OS_DYNAMIC) || defined(OS_DETECTION_ENABLE)
-/**
- * @brief Callback for whether the host uses Mac vs. Windows/Linux hotkeys.
- *
- * Optionally, this callback may be defined to indicate dynamically whether the
- * keyboard is being used with a Mac or non-Mac system.
- *
- * For instance suppose layer 0 is your base layer for Windows and layer 1 is
- * your base layer for Mac. Indicate this by adding in keymap.c:
- *
- *     bool select_word_host_is_mac(void) {
- *       return IS_LAYER_ON(1);  // Supposing layer 1 = base layer for Mac.
- *     }
- */
-bool select_word_host_is_mac(void);
-#endif  // defined(SELECT_WORD_OS_DYNAMIC) || defined(OS_DETECTION_ENABLE)
-
 #ifdef __cplusplus
 }
 #endif
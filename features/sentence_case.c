@@ -24,6 +24,8 @@
 
 #include <string.h>
 
+#include "sentence_case_abbrev_data.h"
+
 #if !defined(IS_QK_MOD_TAP)
 // Attempt to detect out-of-date QMK installation, which would fail with
 // implicit-function-declaration errors in the code below.
@@ -38,6 +40,16 @@
 // Number of keys of state history to retain for backspacing.
 #define STATE_HISTORY_SIZE 6
 
+#if SENTENCE_CASE_BUFFER_SIZE >= TEXT_HISTORY_SIZE
+// The keys before the current one are read from the text history.
+#error "sentence_case: SENTENCE_CASE_BUFFER_SIZE must be less than TEXT_HISTORY_SIZE"
+#elif SENTENCE_CASE_BUFFER_SIZE > 1 && \
+    SENTENCE_CASE_BUFFER_SIZE <= SENTENCE_CASE_ABBREV_MAX_LENGTH
+// The keys checked must reach back over the longest abbreviation in
+// sentence_case_abbrev_dict.txt and the space before it.
+#error "sentence_case: SENTENCE_CASE_BUFFER_SIZE is too small for the abbreviations"
+#endif
+
 // clang-format off
 /** States in matching the beginning of a sentence. */
 enum {
@@ -50,13 +62,97 @@ enum {
 };
 // clang-format on
 
+/** Classes of the characters returned by `sentence_case_press_user()`. */
+enum {
+  CLASS_OTHER,   /**< Symbol or other key, '#'. */
+  CLASS_LETTER,  /**< Letter, 'a'. */
+  CLASS_ENDING,  /**< Sentence-ending punctuation, '.'. */
+  CLASS_SPACE,   /**< Space, ' '. */
+  CLASS_QUOTE,   /**< Quote, '\''. */
+  NUM_CLASSES,
+};
+
+/** Actions of a transition, in the bits above its new state. */
+enum {
+  /** Capitalize this key, unless it is the suppressed key; then go to INIT. */
+  ACTION_CAPITALIZE = 0x08,
+  /** Go to INIT unless the keys before this one end a sentence. */
+  ACTION_CHECK_BEFORE = 0x10,
+  /** Go to INIT unless the keys up to this one end a sentence. */
+  ACTION_CHECK = 0x20,
+  /** Stop suppressing a key from being capitalized. */
+  ACTION_UNSUPPRESS = 0x40,
+};
+// The new state is in the low bits of a transition, so there may be up to 8
+// states, including STATE_DISABLED.
+#define TRANSITION_STATE_MASK 0x07
+
+// Class of each character that `sentence_case_press_user()` may return.
+static const uint8_t char_classes[256] PROGMEM = {
+    ['a'] = CLASS_LETTER,
+    ['.'] = CLASS_ENDING,
+    [' '] = CLASS_SPACE,
+    ['\''] = CLASS_QUOTE,
+};
+
+// The transition of each state by each character class, the new state ORed
+// with actions. Entries left out go to STATE_INIT. STATE_DISABLED has no row,
+// since no keys are processed in it. The new states are:
+//
+//             '#'      'a'       '.'      ' '      '\''
+//           +----------------------------------------------
+//   INIT    | INIT     WORD      ABBREV   INIT     INIT
+//   WORD    | INIT     WORD      ENDING   INIT     WORD
+//   ABBREV  | INIT     ABBREV    ABBREV   INIT     ABBREV
+//   ENDING  | INIT     ABBREV    ABBREV   PRIMED   ENDING
+//   PRIMED  | INIT     match!    ABBREV   PRIMED   PRIMED
+static const uint8_t transitions[STATE_DISABLED][NUM_CLASSES] PROGMEM = {
+    [STATE_INIT] =
+        {
+            [CLASS_LETTER] = STATE_WORD,
+            [CLASS_ENDING] = STATE_ABBREV,
+        },
+    [STATE_WORD] =
+        {
+            [CLASS_LETTER] = STATE_WORD,
+            [CLASS_ENDING] = STATE_ENDING | ACTION_CHECK,
+            [CLASS_QUOTE] = STATE_WORD,
+        },
+    [STATE_ABBREV] =
+        {
+            [CLASS_LETTER] = STATE_ABBREV,
+            [CLASS_ENDING] = STATE_ABBREV,
+            [CLASS_QUOTE] = STATE_ABBREV,
+        },
+    [STATE_ENDING] =
+        {
+            [CLASS_LETTER] = STATE_ABBREV,
+            [CLASS_ENDING] = STATE_ABBREV,
+            [CLASS_SPACE] =
+                STATE_PRIMED | ACTION_CHECK_BEFORE | ACTION_UNSUPPRESS,
+            [CLASS_QUOTE] = STATE_ENDING,
+        },
+    [STATE_PRIMED] =
+        {
+            [CLASS_LETTER] = STATE_WORD | ACTION_CAPITALIZE,
+            [CLASS_ENDING] = STATE_ABBREV,
+            [CLASS_SPACE] = STATE_PRIMED | ACTION_UNSUPPRESS,
+            [CLASS_QUOTE] = STATE_PRIMED,
+        },
+};
+
 #if SENTENCE_CASE_TIMEOUT > 0
 static uint16_t idle_timer = 0;
 #endif  // SENTENCE_CASE_TIMEOUT > 0
+// The keys typed are read from the shared text history (see
+// features/text_event.h) through `keys`. The state history is a ring buffer,
+// so that a key press or backspace moves a head index rather than every entry.
+// The head is where the next entry goes, which is also where the oldest is.
 #if SENTENCE_CASE_BUFFER_SIZE > 1
-static uint16_t key_buffer[SENTENCE_CASE_BUFFER_SIZE] = {0};
+static text_history_cursor_t keys = {0};
 #endif  // SENTENCE_CASE_BUFFER_SIZE > 1
 static uint8_t state_history[STATE_HISTORY_SIZE];
+static uint8_t state_head = 0;
 static uint16_t suppress_key = KC_NO;
 static uint8_t sentence_state = STATE_INIT;
 
@@ -92,7 +188,7 @@ void sentence_case_clear(void) {
   clear_state_history();
   suppress_key = KC_NO;
 #if SENTENCE_CASE_BUFFER_SIZE > 1
-  memset(key_buffer, 0, sizeof(key_buffer));
+  keys.count = 0;
 #endif  // SENTENCE_CASE_BUFFER_SIZE > 1
 }
 
@@ -139,171 +235,108 @@ bool process_sentence_case(uint16_t keycode, keyrecord_t* record) {
   if (sentence_state == STATE_DISABLED || !record->event.pressed) {
     return true;
   }
+  text_event_t event;
+  text_event_normalize(&event, keycode, record);
+  text_history_append(&event, record);
+  return process_sentence_case_event(&event, record);
+}
+
+bool process_sentence_case_event(const text_event_t* event,
+                                 keyrecord_t* record) {
+  // Only process while enabled, and only process press events.
+  if (sentence_state == STATE_DISABLED || !record->event.pressed) {
+    return true;
+  }
 
 #if SENTENCE_CASE_TIMEOUT > 0
   idle_timer = (record->event.time + SENTENCE_CASE_TIMEOUT) | 1;
 #endif  // SENTENCE_CASE_TIMEOUT > 0
 
-  switch (keycode) {
-    case KC_LCTL ... KC_RGUI:  // Ignore mod keys.
-    case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:  // Ignore one-shot mod.
-    // Ignore MO, TO, TG, TT, OSL, TL layer switch keys.
-    case QK_MOMENTARY ... QK_MOMENTARY_MAX:
-    case QK_TO ... QK_TO_MAX:
-    case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
-    case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
-    case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:  // Ignore one-shot layer.
-#ifdef TRI_LAYER_ENABLE  // Ignore Tri Layer keys.
-    case QK_TRI_LAYER_LOWER:
-    case QK_TRI_LAYER_UPPER:
-#endif  // TRI_LAYER_ENABLE
-      return true;
-
-#ifndef NO_ACTION_TAPPING
-    case QK_MOD_TAP ... QK_MOD_TAP_MAX:
-      if (record->tap.count == 0) {
-        return true;
-      }
-      keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
-      break;
-#ifndef NO_ACTION_LAYER
-    case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
-      if (record->tap.count == 0) {
-        return true;
-      }
-      keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
-      break;
-#endif  // NO_ACTION_LAYER
-#endif  // NO_ACTION_TAPPING
-
-#ifdef SWAP_HANDS_ENABLE
-    case QK_SWAP_HANDS ... QK_SWAP_HANDS_MAX:
-      if (IS_SWAP_HANDS_KEYCODE(keycode) || record->tap.count == 0) {
-        return true;
-      }
-      keycode = QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode);
-      break;
-#endif  // SWAP_HANDS_ENABLE
+  // Ignore mod keys, layer switch keys and held tap-hold keys.
+  if (!event->is_tap) {
+    return true;
   }
+  const uint16_t keycode = event->keycode;
 
-  if (keycode == KC_BSPC) {
-    // Backspace key pressed. Rewind the state and key buffers.
-    set_sentence_state(state_history[STATE_HISTORY_SIZE - 1]);
-
-    memmove(state_history + 1, state_history, STATE_HISTORY_SIZE - 1);
-    state_history[0] = STATE_INIT;
 #if SENTENCE_CASE_BUFFER_SIZE > 1
-    memmove(key_buffer + 1, key_buffer,
-            (SENTENCE_CASE_BUFFER_SIZE - 1) * sizeof(uint16_t));
-    key_buffer[0] = KC_NO;
+  // Follow the text history over this key. Keys missed, like those that
+  // handlers before this one consumed, start the keys over.
+  text_history_follow(&keys, TEXT_HISTORY_SIZE);
 #endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+
+  if (keycode == KC_BSPC) {
+    // Backspace key pressed. Rewind the state history; the text history has
+    // dropped the key. The newest entry's slot becomes the oldest, which is
+    // cleared.
+    state_head = (state_head ? state_head : STATE_HISTORY_SIZE) - 1;
+    set_sentence_state(state_history[state_head]);
+    state_history[state_head] = STATE_INIT;
     return true;
   }
 
-  const uint8_t mods = get_mods() | get_weak_mods() | get_oneshot_mods();
-  uint8_t new_state = STATE_INIT;
-
   // We search for sentence beginnings using a simple finite state machine. It
   // matches things like "a. a" and "a.  a" but not "a.. a" or "a.a. a". The
-  // state transition matrix is:
-  //
-  //             'a'       '.'      ' '      '\''
-  //           +-------------------------------------
-  //   INIT    | WORD      INIT     INIT     INIT
-  //   WORD    | WORD      ENDING   INIT     WORD
-  //   ABBREV  | ABBREV    ABBREV   INIT     ABBREV
-  //   ENDING  | ABBREV    INIT     PRIMED   ENDING
-  //   PRIMED  | match!    INIT     PRIMED   PRIMED
-  char code = sentence_case_press_user(keycode, record, mods);
+  // key is classified by the character `sentence_case_press_user()` returns,
+  // and the state and class select a transition in `transitions`.
+  const char code = sentence_case_press_user(keycode, record, event->mods);
 #if defined SENTENCE_CASE_DEBUG
   dprintf("Sentence Case: code = '%c' (%d)\n", code, (int)code);
 #endif  // SENTENCE_CASE_DEBUG
-  switch (code) {
-    case '\0':  // Current key should be ignored.
-      return true;
-
-    case 'a':  // Current key is a letter.
-      switch (sentence_state) {
-        case STATE_ABBREV:
-        case STATE_ENDING:
-          new_state = STATE_ABBREV;
-          break;
-
-        case STATE_PRIMED:
-          // This is the start of a sentence.
-          if (keycode != suppress_key) {
-            suppress_key = keycode;
-            set_oneshot_mods(MOD_BIT(KC_LSFT));  // Shift mod to capitalize.
-            new_state = STATE_WORD;
-          }
-          break;
-
-        default:
-          new_state = STATE_WORD;
-      }
-      break;
-
-    case '.':  // Current key is sentence-ending punctuation.
-      switch (sentence_state) {
-        case STATE_WORD:
-          new_state = STATE_ENDING;
-          break;
-
-        default:
-          new_state = STATE_ABBREV;
-      }
-      break;
-
-    case ' ':  // Current key is a space.
-      if (sentence_state == STATE_PRIMED ||
-          (sentence_state == STATE_ENDING
-#if SENTENCE_CASE_BUFFER_SIZE > 1
-           && sentence_case_check_ending(key_buffer)
-#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
-               )) {
-        new_state = STATE_PRIMED;
-        suppress_key = KC_NO;
-      }
-      break;
-
-    case '\'':  // Current key is a quote.
-      new_state = sentence_state;
-      break;
+  if (code == '\0') {  // Current key should be ignored.
+    return true;
   }
+  uint8_t transition = pgm_read_byte(
+      &transitions[sentence_state][pgm_read_byte(char_classes + (uint8_t)code)]);
 
-    // Slide key_buffer and state_history buffers one element to the left.
-    // Optimization note: Using manual loops instead of memmove() here saved
-    // ~100 bytes on AVR.
 #if SENTENCE_CASE_BUFFER_SIZE > 1
-  for (int8_t i = 0; i < SENTENCE_CASE_BUFFER_SIZE - 1; ++i) {
-    key_buffer[i] = key_buffer[i + 1];
-  }
-#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
-  for (int8_t i = 0; i < STATE_HISTORY_SIZE - 1; ++i) {
-    state_history[i] = state_history[i + 1];
+  if (transition & ACTION_CHECK_BEFORE) {
+    // The keys before this one. As `keys` holds more than
+    // SENTENCE_CASE_BUFFER_SIZE keys before it saturates, dropping one is
+    // exact.
+    const text_history_cursor_t before = {keys.end - 1,
+                                          keys.count ? keys.count - 1 : 0};
+    if (!sentence_case_check_ending(&before)) {
+      transition = STATE_INIT;
+    }
   }
-
-#if SENTENCE_CASE_BUFFER_SIZE > 1
-  key_buffer[SENTENCE_CASE_BUFFER_SIZE - 1] = keycode;
-  if (new_state == STATE_ENDING && !sentence_case_check_ending(key_buffer)) {
+  if ((transition & ACTION_CHECK) && !sentence_case_check_ending(&keys)) {
 #if defined SENTENCE_CASE_DEBUG
     dprintf("Not a real ending.\n");
 #endif  // SENTENCE_CASE_DEBUG
-    new_state = STATE_INIT;
+    transition = STATE_INIT;
   }
 #endif  // SENTENCE_CASE_BUFFER_SIZE > 1
-  state_history[STATE_HISTORY_SIZE - 1] = sentence_state;
 
-  set_sentence_state(new_state);
+  if (transition & ACTION_CAPITALIZE) {
+    // This is the start of a sentence.
+    if (keycode != suppress_key) {
+      suppress_key = keycode;
+      set_oneshot_mods(MOD_BIT(KC_LSFT));  // Shift mod to capitalize.
+    } else {
+      transition = STATE_INIT;
+    }
+  }
+  if (transition & ACTION_UNSUPPRESS) {
+    suppress_key = KC_NO;
+  }
+
+  // Append the state, overwriting the oldest entry.
+  state_history[state_head] = sentence_state;
+  if (++state_head == STATE_HISTORY_SIZE) {
+    state_head = 0;
+  }
+
+  set_sentence_state(transition & TRANSITION_STATE_MASK);
   return true;
 }
 
-bool sentence_case_just_typed_P(const uint16_t* buffer, const uint16_t* pattern,
-                                int8_t pattern_len) {
+bool sentence_case_just_typed_P(const text_history_cursor_t* keys,
+                                const uint16_t* pattern, int8_t pattern_len) {
 #if SENTENCE_CASE_BUFFER_SIZE > 1
-  buffer += SENTENCE_CASE_BUFFER_SIZE - pattern_len;
+  // The pattern's last key is the newest of `keys`.
   for (int8_t i = 0; i < pattern_len; ++i) {
-    if (buffer[i] != pgm_read_word(pattern + i)) {
+    if (text_history_keycode(keys, pattern_len - 1 - i) !=
+        pgm_read_word(pattern + i)) {
       return false;
     }
   }
@@ -313,53 +346,46 @@ bool sentence_case_just_typed_P(const uint16_t* buffer, const uint16_t* pattern,
 #endif  // SENTENCE_CASE_BUFFER_SIZE > 1
 }
 
-__attribute__((weak)) bool sentence_case_check_ending(const uint16_t* buffer) {
-#if SENTENCE_CASE_BUFFER_SIZE >= 5
-  // Don't consider the abbreviations "vs." and "etc." to end the sentence.
-  if (SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_V, KC_S, KC_DOT) ||
-      SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_E, KC_T, KC_C, KC_DOT)) {
-    return false;  // Not a real sentence ending.
+__attribute__((weak)) bool sentence_case_check_ending(
+    const text_history_cursor_t* keys) {
+#if SENTENCE_CASE_BUFFER_SIZE > 1
+  // Don't consider abbreviations like "vs." and "etc." to end the sentence.
+  // Walk the trie of sentence_case_abbrev_dict.txt from the last key back. A
+  // node is a list of (key, offset of the node for the keys before it) entries,
+  // ending with 0. The start of typing is as a space.
+  uint16_t node = 0;
+  for (uint8_t n = 0; n < SENTENCE_CASE_BUFFER_SIZE; ++n) {
+    uint8_t keycode = text_history_keycode(keys, n);
+    if (!keycode) {
+      keycode = KC_SPC;
+    }
+    for (;; node += 3) {
+      const uint8_t key = pgm_read_byte(sentence_case_abbrev_data + node);
+      if (!key) {
+        return true;  // Real sentence ending; capitalize next letter.
+      } else if (key == keycode) {
+        break;
+      }
+    }
+    node = pgm_read_byte(sentence_case_abbrev_data + node + 1) |
+           pgm_read_byte(sentence_case_abbrev_data + node + 2) << 8;
+    if (!node) {
+      return false;  // Not a real sentence ending.
+    }
   }
-#endif  // SENTENCE_CASE_BUFFER_SIZE >= 5
+#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
   return true;  // Real sentence ending; capitalize next letter.
 }
 
 __attribute__((weak)) char sentence_case_press_user(uint16_t keycode,
                                                     keyrecord_t* record,
                                                     uint8_t mods) {
-  if ((mods & ~(MOD_MASK_SHIFT | MOD_BIT(KC_RALT))) == 0) {
-    const bool shifted = mods & MOD_MASK_SHIFT;
-    switch (keycode) {
-      case KC_A ... KC_Z:
-        return 'a';  // Letter key.
-
-      case KC_DOT:  // . is punctuation, Shift . is a symbol (>)
-        return !shifted ? '.' : '#';
-      case KC_1:
-      case KC_SLSH:
-        return shifted ? '.' : '#';
-      case KC_EXLM:
-      case KC_QUES:
-        return '.';
-      case KC_2 ... KC_0:  // 2 3 4 5 6 7 8 9 0
-      case KC_AT ... KC_RPRN:  // @ # $ % ^ & * ( )
-      case KC_MINS ... KC_SCLN:  // - = [ ] backslash ;
-      case KC_UNDS ... KC_COLN:  // _ + { } | :
-      case KC_GRV:
-      case KC_COMM:
-        return '#';  // Symbol key.
-
-      case KC_SPC:
-        return ' ';  // Space key.
-
-      case KC_QUOT:
-        return '\'';  // Quote key.
-    }
+  const char code = text_event_code(keycode, mods);
+  if (code == '\0') {
+    // Clear Sentence Case to initial state.
+    sentence_case_clear();
   }
-
-  // Otherwise clear Sentence Case to initial state.
-  sentence_case_clear();
-  return '\0';
+  return code;
 }
 
 __attribute__((weak)) void sentence_case_primed(bool primed) {}
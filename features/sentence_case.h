@@ -33,9 +33,12 @@
  *   "a... a"
  *   "a.a. a"
  *
- * Additionally by default, abbreviations "vs." and "etc." are exceptionally
- * detected as not real sentence endings. You can use the callback
- * `sentence_case_check_ending()` to define other exceptions.
+ * Additionally by default, abbreviations like "vs.", "etc." and "approx." are
+ * exceptionally detected as not real sentence endings. They are listed in
+ * sentence_case_abbrev_dict.txt, from which make_sentence_case_abbrev_data.py
+ * generates a trie that is walked once backwards from the last key typed. You
+ * can also use the callback `sentence_case_check_ending()` to define other
+ * exceptions.
  *
  * @note One-shot keys must be enabled.
  *
@@ -46,14 +49,17 @@
 #pragma once
 
 #include "quantum.h"
+#include "text_event.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// The size of the keycode buffer for `sentence_case_check_ending()`. It must be
-// at least as large as the longest pattern checked. If less than 2, buffering
-// is disabled and the callback is not called.
+// How many of the last keys `sentence_case_check_ending()` reads, from the text
+// history (features/text_event.h). It must be at least as large as the longest
+// pattern checked, longer than the longest abbreviation in
+// sentence_case_abbrev_dict.txt, and less than TEXT_HISTORY_SIZE. If less than
+// 2, the callback is not called.
 #ifndef SENTENCE_CASE_BUFFER_SIZE
 #define SENTENCE_CASE_BUFFER_SIZE 8
 #endif  // SENTENCE_CASE_BUFFER_SIZE
@@ -65,6 +71,14 @@ extern "C" {
  */
 bool process_sentence_case(uint16_t keycode, keyrecord_t* record);
 
+/**
+ * Handler function for Sentence Case, given the event decoded by
+ * `text_event_normalize()`, for keymaps that share it with other features.
+ * Add the event to the text history with `text_history_append()` first.
+ */
+bool process_sentence_case_event(const text_event_t* event,
+                                 keyrecord_t* record);
+
 /**
  * @fn sentence_case_task(void)
  * Matrix task function for Sentence Case.
@@ -101,13 +115,15 @@ void sentence_case_primed(bool primed);
  * When a sentence-ending punctuation key is typed, this callback is called to
  * determine whether it is a real sentence ending, meaning the first letter of
  * the following word should be capitalized. For instance, abbreviations like
- * "vs." are usually not real sentence endings. The input argument is a buffer
- * of the last SENTENCE_CASE_BUFFER_SIZE keycodes. Returning true means it is a
- * real sentence ending; returning false means it is not.
+ * "vs." are usually not real sentence endings. The input argument is a cursor
+ * into the text history of the keys typed, ending with the punctuation key or
+ * the key after it. Returning true means it is a real sentence ending;
+ * returning false means it is not.
  *
- * The default implementation checks for the abbreviations "vs." and "etc.":
+ * The default implementation checks for the abbreviations in
+ * sentence_case_abbrev_dict.txt. A callback for just "vs." and "etc." could be:
  *
- *     bool sentence_case_check_ending(const uint16_t* buffer) {
+ *     bool sentence_case_check_ending(const text_history_cursor_t* keys) {
  *       // Don't consider "vs." and "etc." to end the sentence.
  *       if (SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_V, KC_S, KC_DOT) ||
  *           SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_E, KC_T, KC_C, KC_DOT)) {
@@ -119,16 +135,19 @@ void sentence_case_primed(bool primed);
  * @note This callback is used only if `SENTENCE_CASE_BUFFER_SIZE >= 2`.
  *       Otherwise it has no effect.
  *
- * @param buffer Buffer of the last `SENTENCE_CASE_BUFFER_SIZE` keycodes.
+ * @param keys Cursor of the last keys typed. Read the last
+ *        `SENTENCE_CASE_BUFFER_SIZE` of them with `SENTENCE_CASE_JUST_TYPED()`
+ *        or `text_history_keycode()`; keys before Sentence Case last cleared
+ *        are KC_NO.
  * @return whether there is a real sentence ending.
  */
-bool sentence_case_check_ending(const uint16_t* buffer);
+bool sentence_case_check_ending(const text_history_cursor_t* keys);
 
 /**
  * Macro to be used in `sentence_case_check_ending()`.
  *
  * Returns true if a given pattern of keys was just typed by comparing with the
- * keycode buffer. This is useful for defining exceptions in
+ * `keys` cursor. This is useful for defining exceptions in
  * `sentence_case_check_ending()`.
  *
  * For example, `SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_V, KC_S, KC_DOT)` returns
@@ -139,11 +158,11 @@ bool sentence_case_check_ending(const uint16_t* buffer);
 #define SENTENCE_CASE_JUST_TYPED(...)                               \
   ({                                                                \
     static const uint16_t PROGMEM pattern[] = {__VA_ARGS__};        \
-    sentence_case_just_typed_P(buffer, pattern,                     \
+    sentence_case_just_typed_P(keys, pattern,                       \
                                sizeof(pattern) / sizeof(uint16_t)); \
   })
-bool sentence_case_just_typed_P(const uint16_t* buffer, const uint16_t* pattern,
-                                int8_t pattern_len);
+bool sentence_case_just_typed_P(const text_history_cursor_t* keys,
+                                const uint16_t* pattern, int8_t pattern_len);
 
 /**
  * Optional callback defining which keys are letter, punctuation, etc.
@@ -166,52 +185,34 @@ bool sentence_case_just_typed_P(const uint16_t* buffer, const uint16_t* pattern,
  *
  *  '\0'  Sentence Case should ignore this key.
  *
+ * Any other character is as '#'. Each character is mapped to a class by the
+ * `char_classes` table in sentence_case.c, and the state machine steps by the
+ * `transitions` table of state by class, so new characters and states, e.g.
+ * for a newline or a colon, are added as table entries.
+ *
  * If a hotkey or navigation key is pressed (or another key that performs an
  * action that backspace doesn't undo), then the callback should call
  * `sentence_case_clear()` to clear the state and then return '\0'.
  *
- * The default callback is:
+ * The keycode is the basic keycode of what the key types: tap-hold keys are
+ * given as their tap keycode, and modified keycodes like KC_EXLM as the basic
+ * keycode KC_1 with Shift in `mods`. The default callback classifies the key
+ * with `text_event_code()` (see features/text_event.c), which returns '\0'
+ * for keys typed with mods other than Shift and AltGr:
  *
  *     char sentence_case_press_user(uint16_t keycode,
  *                                   keyrecord_t* record,
  *                                   uint8_t mods) {
- *       if ((mods & ~(MOD_MASK_SHIFT | MOD_BIT(KC_RALT))) == 0) {
- *         const bool shifted = mods & MOD_MASK_SHIFT;
- *         switch (keycode) {
- *           case KC_A ... KC_Z:
- *             return 'a';  // Letter key.
- *
- *           case KC_DOT:  // . is punctuation, Shift . is a symbol (>)
- *             return !shifted ? '.' : '#';
- *           case KC_1:
- *           case KC_SLSH:
- *             return shifted ? '.' : '#';
- *           case KC_EXLM:
- *           case KC_QUES:
- *             return '.';
- *           case KC_2 ... KC_0:  // 2 3 4 5 6 7 8 9 0
- *           case KC_AT ... KC_RPRN:  // @ # $ % ^ & * ( )
- *           case KC_MINS ... KC_SCLN:  // - = [ ] backslash ;
- *           case KC_UNDS ... KC_COLN:  // _ + { } | :
- *           case KC_GRV:
- *           case KC_COMM:
- *             return '#';  // Symbol key.
- *
- *           case KC_SPC:
- *             return ' ';  // Space key.
- *
- *           case KC_QUOT:
- *             return '\'';  // Quote key.
- *         }
+ *       const char code = text_event_code(keycode, mods);
+ *       if (code == '\0') {
+ *         // Clear Sentence Case to initial state.
+ *         sentence_case_clear();
  *       }
- *
- *       // Otherwise clear Sentence Case to initial state.
- *       sentence_case_clear();
- *       return '\0';
+ *       return code;
  *     }
  *
- * To customize, copy the above function into your keymap and add/remove
- * keycodes to the above cases.
+ * To customize, copy the above function into your keymap and handle other
+ * keycodes before calling `text_event_code()`.
  *
  * @param keycode Current keycode.
  * @param record record_t for the current press event.
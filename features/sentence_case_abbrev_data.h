@@ -0,0 +1,60 @@
+// Generated code.
+
+// Sentence Case abbreviations (39 entries):
+//   approx.
+//   appt.
+//   apt.
+//   assn.
+//   ave.
+//   blvd.
+//   cf.
+//   co.
+//   corp.
+//   dept.
+//   dr.
+//   e.g.
+//   esp.
+//   est.
+//   etc.
+//   ex.
+//   gen.
+//   i.e.
+//   inc.
+//   incl.
+//   jr.
+//   lt.
+//   ltd.
+//   misc.
+//   mr.
+//   mrs.
+//   ms.
+//   mt.
+//   n.b.
+//   pp.
+//   prof.
+//   resp.
+//   rev.
+//   sgt.
+//   sr.
+//   st.
+//   viz.
+//   vol.
+//   vs.
+
+#define SENTENCE_CASE_ABBREV_MAX_LENGTH 7
+
+static const uint8_t sentence_case_abbrev_data[294] PROGMEM = {55, 4, 0, 0, 5,
+  53, 0, 6, 57, 0, 7, 67, 0, 8, 74, 0, 9, 81, 0, 10, 88, 0, 15, 92, 0, 17, 99,
+  0, 18, 106, 0, 19, 110, 0, 21, 120, 0, 22, 133, 0, 23, 143, 0, 25, 159, 0, 27,
+  163, 0, 29, 170, 0, 0, 55, 174, 0, 0, 17, 178, 0, 22, 182, 0, 23, 186, 0, 0,
+  23, 190, 0, 25, 194, 0, 0, 55, 178, 0, 25, 198, 0, 0, 6, 202, 0, 18, 206, 0,
+  0, 55, 186, 0, 0, 6, 210, 0, 18, 214, 0, 0, 8, 218, 0, 22, 222, 0, 0, 6, 202,
+  0, 0, 19, 202, 0, 21, 226, 0, 22, 230, 0, 0, 7, 202, 0, 13, 202, 0, 16, 202,
+  0, 22, 202, 0, 0, 16, 202, 0, 21, 234, 0, 25, 202, 0, 0, 10, 238, 0, 15, 202,
+  0, 16, 202, 0, 19, 242, 0, 22, 252, 0, 0, 8, 3, 1, 0, 8, 202, 0, 18, 7, 1, 0,
+  12, 214, 0, 0, 17, 202, 0, 0, 12, 202, 0, 0, 12, 234, 0, 0, 8, 202, 0, 0, 15,
+  202, 0, 0, 15, 11, 1, 0, 4, 202, 0, 0, 44, 0, 0, 0, 21, 15, 1, 0, 17, 178, 0,
+  0, 25, 202, 0, 0, 10, 202, 0, 0, 22, 198, 0, 0, 18, 106, 0, 0, 8, 19, 1, 0,
+  16, 202, 0, 0, 22, 202, 0, 0, 4, 202, 0, 8, 26, 1, 19, 198, 0, 0, 44, 0, 0, 8,
+  202, 0, 0, 21, 202, 0, 0, 21, 30, 1, 0, 5, 202, 0, 0, 19, 202, 0, 0, 44, 0, 0,
+  21, 202, 0, 0, 7, 202, 0, 0, 19, 34, 1, 0, 19, 198, 0, 0};
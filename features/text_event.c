@@ -0,0 +1,190 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file text_event.c
+ * @brief Text Event implementation
+ */
+
+#include "features/text_event.h"
+
+#if TEXT_HISTORY_SIZE < 2 || TEXT_HISTORY_SIZE > 128 || \
+    (TEXT_HISTORY_SIZE & (TEXT_HISTORY_SIZE - 1)) != 0
+#error "text_event: TEXT_HISTORY_SIZE must be a power of 2 from 2 to 128"
+#endif
+#define TEXT_HISTORY_MASK (TEXT_HISTORY_SIZE - 1)
+// A key in the text history is its keycode, with this bit set if shifted.
+#define TEXT_HISTORY_SHIFT 0x80
+
+// The text history is a ring buffer. Positions count keys appended modulo 256,
+// so that cursors can tell how far they are behind. `head` is the position
+// where the next key goes, and `prev_head` where it was before the key event
+// last appended.
+static uint8_t history[TEXT_HISTORY_SIZE] = {0};
+static uint8_t head = 0;
+static uint8_t prev_head = 0;
+
+// Class of each basic keycode, unshifted and shifted. Keycodes left out are
+// '\0', keys that don't type text.
+// clang-format off
+static const char basic_codes[256][2] PROGMEM = {
+    [KC_A ... KC_Z]       = {'a',  'a'},
+    [KC_DOT]              = {'.',  '#'},   // . is punctuation, > a symbol.
+    [KC_1]                = {'#',  '.'},   // !
+    [KC_SLSH]             = {'#',  '.'},   // ?
+    [KC_2 ... KC_0]       = {'#',  '#'},   // Digits and @ # $ % ^ & * ( )
+    [KC_MINS ... KC_SCLN] = {'#',  '#'},   // - = [ ] \ ; and _ + { } | :
+    [KC_GRV]              = {'#',  '#'},
+    [KC_COMM]             = {'#',  '#'},
+    [KC_SPC]              = {' ',  ' '},
+    [KC_QUOT]             = {'\'', '\''},  // ' and "
+};
+// clang-format on
+
+char text_event_code(uint16_t keycode, uint8_t mods) {
+  if (keycode > 0xff || (mods & ~(MOD_MASK_SHIFT | MOD_BIT(KC_RALT))) != 0) {
+    return '\0';
+  }
+  return pgm_read_byte(&basic_codes[keycode][(mods & MOD_MASK_SHIFT) != 0]);
+}
+
+void text_event_normalize(text_event_t* event, uint16_t keycode,
+                          keyrecord_t* record) {
+  uint8_t mods = get_mods() | get_weak_mods();
+#ifndef NO_ACTION_ONESHOT
+  mods |= get_oneshot_mods();
+#endif  // NO_ACTION_ONESHOT
+  bool is_tap = true;
+
+  switch (keycode) {
+    // Modifier, one-shot and layer switch keys type nothing. DF and QK_LLCK
+    // are left out: like other keys, they clear Sentence Case and end a Select
+    // Word selection.
+    case MODIFIER_KEYCODE_RANGE:
+    case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+    case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
+    case QK_TO ... QK_TO_MAX:
+    case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+    case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+#ifndef NO_ACTION_ONESHOT
+    case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+    case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
+#endif  // NO_ACTION_ONESHOT
+#ifdef TRI_LAYER_ENABLE
+    case QK_TRI_LAYER_LOWER:
+    case QK_TRI_LAYER_UPPER:
+#endif  // TRI_LAYER_ENABLE
+      is_tap = false;
+      break;
+
+    // Modified keycodes like KC_EXLM = S(KC_1) type their basic keycode with
+    // their mods.
+    case QK_MODS ... QK_MODS_MAX: {
+      const uint8_t key_mods = QK_MODS_GET_MODS(keycode);
+      mods |= (key_mods & 0x10) ? (key_mods & 0x0f) << 4 : key_mods;
+      keycode = QK_MODS_GET_BASIC_KEYCODE(keycode);
+    } break;
+
+#ifndef NO_ACTION_TAPPING
+    // Tap-hold keys type their tap keycode when tapped.
+    case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+      if (record->tap.count == 0) {
+        is_tap = false;
+      } else {
+        keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+      }
+      break;
+#ifndef NO_ACTION_LAYER
+    case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+      if (record->tap.count == 0) {
+        is_tap = false;
+      } else {
+        keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+      }
+      break;
+#endif  // NO_ACTION_LAYER
+#endif  // NO_ACTION_TAPPING
+
+#ifdef SWAP_HANDS_ENABLE
+    case QK_SWAP_HANDS ... QK_SWAP_HANDS_MAX:
+      if (IS_SWAP_HANDS_KEYCODE(keycode) || record->tap.count == 0) {
+        is_tap = false;
+      } else {
+        keycode = QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode);
+      }
+      break;
+#endif  // SWAP_HANDS_ENABLE
+  }
+
+  event->keycode = keycode;
+  event->mods = mods;
+  event->code = is_tap ? text_event_code(keycode, mods) : '\0';
+  event->is_tap = is_tap;
+}
+
+void text_history_append(const text_event_t* event,
+                         const keyrecord_t* record) {
+  prev_head = head;
+  if (!record->event.pressed || !event->is_tap) {
+    return;
+  }
+
+  switch (event->keycode) {
+    case KC_NO:
+    case KC_CAPS:
+      return;
+
+    case KC_BSPC:
+      --head;
+      return;
+  }
+
+  uint8_t key = (event->keycode <= 0x7f) ? event->keycode : KC_NO;
+  if (event->mods & MOD_MASK_SHIFT) {
+    key |= TEXT_HISTORY_SHIFT;
+  }
+  history[head++ & TEXT_HISTORY_MASK] = key;
+}
+
+bool text_history_follow(text_history_cursor_t* cursor, uint8_t max_count) {
+  const bool in_sync = cursor->end == prev_head;
+  if (!in_sync) {
+    cursor->count = 0;
+  }
+  if (head == (uint8_t)(prev_head + 1)) {
+    if (cursor->count < max_count && cursor->count < TEXT_HISTORY_SIZE) {
+      ++cursor->count;
+    }
+  } else if (head != prev_head && cursor->count) {
+    --cursor->count;
+  }
+  cursor->end = head;
+  return in_sync;
+}
+
+// The key `n` keys back from the newest of `cursor`, or KC_NO.
+static uint8_t history_key(const text_history_cursor_t* cursor, uint8_t n) {
+  if (n >= cursor->count) {
+    return KC_NO;
+  }
+  return history[(uint8_t)(cursor->end - 1 - n) & TEXT_HISTORY_MASK];
+}
+
+uint8_t text_history_keycode(const text_history_cursor_t* cursor, uint8_t n) {
+  return history_key(cursor, n) & ~TEXT_HISTORY_SHIFT;
+}
+
+bool text_history_shifted(const text_history_cursor_t* cursor, uint8_t n) {
+  return (history_key(cursor, n) & TEXT_HISTORY_SHIFT) != 0;
+}
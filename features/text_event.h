@@ -0,0 +1,159 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file text_event.h
+ * @brief Text Event - one decoding of a key event for text-aware features,
+ * and the history of keys typed
+ *
+ * Overview
+ * --------
+ *
+ * Sentence Case, Select Word and autocorrection each need to know what a key
+ * event types: the basic keycode of a tapped mod-tap or layer-tap key, whether
+ * a tap-hold key is held instead, which mods apply, and whether the key is a
+ * letter, punctuation or space. Rather than each feature unwrapping the keycode
+ * and reading the mods with its own switch, process_record_user() decodes the
+ * event once and hands the result to every text feature:
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       text_event_t event;
+ *       text_event_normalize(&event, keycode, record);
+ *       text_history_append(&event, record);  // See "Text History" below.
+ *       if (!process_sentence_case_event(&event, record)) { return false; }
+ *       if (!process_select_word_event(&event, keycode, record)) {
+ *         return false;
+ *       }
+ *       // Other macros...
+ *       return true;
+ *     }
+ *
+ * The features' `process_*(keycode, record)` functions still work alone, and
+ * normalize the event themselves.
+ *
+ * Text History
+ * ------------
+ *
+ * Sentence Case and autocorrection also look back at the keys typed before,
+ * for abbreviations like "e.g." and to undo keys on backspace. Rather than
+ * each keeping its own buffer of them, they read one shared ring buffer, the
+ * text history. process_record_user() appends each event to it once, as
+ * above, before the features that read it. Each feature keeps a
+ * `text_history_cursor_t` of how many of the last keys it has seen since it
+ * last reset, and moves it over each key event it processes with
+ * `text_history_follow()`. Used alone, the features' `process_*(keycode,
+ * record)` functions append the event themselves.
+ *
+ * The Magic Trigrams context (features/magic_trigrams.h) is not read from
+ * the history: it also takes in text typed by macros, which never passes
+ * through here as key events, and its three keys fit in 2 bytes.
+ *
+ * @note Caps Word and the Repeat Key decode events in QMK core before
+ * process_record_user() is called, and QMK core's Autocorrect after it returns
+ * true, so they don't use this. With AUTOCORRECTION_FLASH_ENABLE,
+ * features/autocorrection.c takes Autocorrect's place at the end of
+ * process_record_user(), with the shared decoding.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number of keys in the text history, a power of 2 up to 128. Autocorrection
+// replays up to 64 keys of a dictionary loaded into flash, see
+// features/autocorrection.c.
+#ifndef TEXT_HISTORY_SIZE
+#ifdef AUTOCORRECTION_FLASH_ENABLE
+#define TEXT_HISTORY_SIZE 64
+#else
+#define TEXT_HISTORY_SIZE 16
+#endif  // AUTOCORRECTION_FLASH_ENABLE
+#endif  // TEXT_HISTORY_SIZE
+
+/** A key event as text-aware features see it. */
+typedef struct {
+  /**
+   * Keycode of what the key types: the tap keycode of a tap-hold key, or the
+   * basic keycode of a modified keycode like KC_EXLM. Other keycodes are as is.
+   */
+  uint16_t keycode;
+  /**
+   * Mods that apply: `get_mods() | get_weak_mods() | get_oneshot_mods()`, and
+   * the mods of a modified keycode.
+   */
+  uint8_t mods;
+  /**
+   * Class of the key by `text_event_code()`: 'a' for letters, '.' for
+   * sentence-ending punctuation, '#' for other symbols, ' ' for space, '\''
+   * for quotes, or '\0' for keys that don't type text.
+   */
+  char code;
+  /**
+   * False if the key is held as a mod or layer switch rather than typing: a
+   * tap-hold key being held, or a modifier, one-shot or layer switch key. Text
+   * features pass over such events.
+   */
+  bool is_tap;
+} text_event_t;
+
+/** Decodes the event of `keycode` and `record` into `event`. */
+void text_event_normalize(text_event_t* event, uint16_t keycode,
+                          keyrecord_t* record);
+
+/**
+ * Class of the basic `keycode` typed with `mods`, as described for
+ * `text_event_t::code`. Keys typed with mods other than Shift and AltGr, such
+ * as hotkeys, are '\0'.
+ */
+char text_event_code(uint16_t keycode, uint8_t mods);
+
+/** A feature's read cursor into the text history. */
+typedef struct {
+  /** Position just after the newest key the feature has seen. */
+  uint8_t end;
+  /** Number of keys up to `end` that the feature has seen since it reset. */
+  uint8_t count;
+} text_history_cursor_t;
+
+/**
+ * Adds the key of `event` to the text history, or on Backspace removes the
+ * newest key. Keys held as mods or layer switches, releases, KC_NO and Caps
+ * Lock leave the history as is. Call this once per key event.
+ */
+void text_history_append(const text_event_t* event, const keyrecord_t* record);
+
+/**
+ * Moves `cursor` over the key event last appended, adding or removing its key
+ * with at most `max_count` keys, and `TEXT_HISTORY_SIZE` keys, kept. Returns
+ * false if the cursor missed key events since it was last moved, in which
+ * case it first starts over with no keys.
+ */
+bool text_history_follow(text_history_cursor_t* cursor, uint8_t max_count);
+
+/**
+ * Basic keycode of the key `n` keys back from the newest key of `cursor`,
+ * or KC_NO if it has fewer keys. Keycodes above 0x7f are KC_NO.
+ */
+uint8_t text_history_keycode(const text_history_cursor_t* cursor, uint8_t n);
+
+/** Whether the key `n` keys back from the newest key of `cursor` was shifted. */
+bool text_history_shifted(const text_history_cursor_t* cursor, uint8_t n);
+
+#ifdef __cplusplus
+}
+#endif
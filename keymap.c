@@ -15,12 +15,21 @@
  */
 #include QMK_KEYBOARD_H
 
+#include "features/autocorrection.h"
+#include "features/autocorrection_flash.h"
 #include "features/custom_shift_keys.h"
 #include "features/select_word.h"
 #include "features/sentence_case.h"
 #include "features/orbital_mouse.h"
 #include "features/socd_cleaner.h"
+#include "features/text_event.h"
 #include "features/mouse_turbo_click.h"
+#include "features/latency_stats.h"
+#include "features/key_trace.h"
+#include "features/macro_bytecode.h"
+#include "features/magic_trigrams.h"
+#include "features/os_profile.h"
+#include "features/output_queue.h"
 #include "features/palettefx.h"
 #include "os_detection.h"
 #include "quantum.h"
@@ -48,6 +57,8 @@ enum custom_keycodes {
     THMBUP,
     REPEAT,
     ALTREP,
+    // Bytecode macros, run from `macro_programs` below. Keep MC_COMMENT to
+    // MC_PANE_RIGHT contiguous: they index `macro_offsets`.
     MC_COMMENT,
     MC_CPR,
     MC_SAVE,
@@ -58,6 +69,7 @@ enum custom_keycodes {
     MC_PREV_TAB,
     MC_BUFFERS,
     MC_SPLIT_HELPER,
+    MC_SELECT_WORD,
     MC_TMUX_PREV,
     MC_TMUX_NEXT,
     MC_TMUX_SPLIT_H,
@@ -78,18 +90,6 @@ enum custom_keycodes {
     MC_TMUX_CHSH,
     MC_TMUX_SESSIONIZER,
     MC_TMUX_SESSIONS,
-    MC_SHIFT_CAPS,
-    M_ION,
-    M_NION,
-    M_MENT,
-    M_QUEN,
-    M_TMENT,
-    M_THE,
-    M_UPDIR,
-    M_INCLUDE,
-    M_DOCSTR,
-    M_MKGRVS,
-    M_EQEQ,
     MC_HARPOON_PREV,
     MC_HARPOON_NEXT,
     MC_HARPOON_GOTO_1,
@@ -116,15 +116,27 @@ enum custom_keycodes {
     MC_PANE_DOWN,
     MC_PANE_UP,
     MC_PANE_RIGHT,
+    MC_SHIFT_CAPS,
+    M_ION,
+    M_NION,
+    M_MENT,
+    M_QUEN,
+    M_TMENT,
+    M_THE,
+    M_UPDIR,
+    M_INCLUDE,
+    M_DOCSTR,
+    M_MKGRVS,
+    M_EQEQ,
     // OS-aware word navigation (Alt on macOS, Ctrl on Win/Linux)
     OS_WORD_LEFT,
     OS_WORD_RIGHT,
     OS_DEL_WORD,
     OS_DEL_WORD_FWD,
-    MC_SELECT_WORD,
     TURBO,
     SELLINE,
     SELWBAK,
+    LATENCY,
     M_FUNC,
     M_IMPORT,
     M_BREAK,
@@ -134,6 +146,7 @@ enum custom_keycodes {
     M_JECT,
     M_KEYWORD,
     M_XPORT,
+    M_TRIGRAM,
 };
 
 // Select Word keycode binding.
@@ -189,9 +202,18 @@ socd_cleaner_t socd_h = {{KC_A, KC_D}, SOCD_CLEANER_LAST};
 //     " *   -> """<cursor>"""  (Python code)
 //     ` *   -> ```<cursor>```  (Markdown code)
 //     # *   -> #include        (C code)
-//     < -   -> <-              (Haskell code)
 //     . *   -> ../             (shell)
 //     . * @ -> ../../
+//
+// With the two or three keys before it as context, the magic key completes
+// words from features/magic_trigram_dict.txt instead, where ":" is a word
+// break:
+//
+//     :th * -> THAT            :sh * -> SHOULD
+//     :wh * -> WHICH           ti *  -> TION
+//
+// These win over the completions above. Contexts where the completion above is
+// useful, like "NE * -> NEU" and "CO * -> COA", have no entry there.
 #define MAGIC QK_AREP // The "magic" key is Alternate Repeat.
 
 // This keymap uses home row mods. In addition to mods, I have home row
@@ -299,7 +321,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     /*
      * MAINTENANCE - System, Orbital Mouse, RGB
      * ,-----------------------------------------.                    ,-----------------------------------------.
-     * |  `   | Boot |      |      |      |      |                    |      |      |      |      |      | Bspc |
+     * |  `   | Boot |Latncy|      |      |      |                    |      |      |      |      |      | Bspc |
      * |------+------+------+------+------+------|                    |------+------+------+------+------+------|
      * | Tab  | Exit |RGB V-|RGB V+|RGB M+|QK_LLC|                    |OM_W_U|OM_BTN|OM_U  |OM_BT2| TURBO| Del  |
      * |------+------+------+------+------+------|                    |------+------+------+------+------+------|
@@ -312,7 +334,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      *            `----------------------------------'           '------''---------------------------'
      */
     [MAINTENANCE] = LAYOUT(
-        KC_GRV,   QK_BOOT,  _______,  _______,  _______,  _______,                        _______,  _______,  _______,  _______,  _______,  KC_BSPC,
+        KC_GRV,   QK_BOOT,  LATENCY,  _______,  _______,  _______,                        _______,  _______,  _______,  _______,  _______,  KC_BSPC,
         KC_TAB,   EXIT,     RM_VALD,  RM_VALU,  RM_NEXT,  QK_LLCK,                        OM_W_U,   OM_BTNS,  OM_U,     OM_BTN2,  TURBO,    KC_DEL,
         KC_ESC,   _______,  RM_HUED,  RM_HUEU,  _______,  _______,                        OM_W_D,   OM_L,     OM_D,     OM_R,     OM_SLOW,  KC_ENT,
         KC_LSFT,  _______,  RM_SATD,  RM_SATU,  _______,  _______,  _______,    _______,  _______,  OM_BTN3,  _______,  _______,  _______,  KC_RSFT,
@@ -454,14 +476,72 @@ uint16_t get_quick_tap_term(uint16_t keycode, keyrecord_t* record) {
     }
 }
 
+// Hand and finger of each key position, packed 5 bits per key and one
+// 32-bit word per matrix row, so that Chordal Hold and Flow Tap need one word
+// read per key. The low 2 bits are the hands that may press the key, the
+// next 3 bits the finger.
+enum {
+    HAND_LEFT   = 1,
+    HAND_RIGHT  = 2,
+    HAND_EITHER = HAND_LEFT | HAND_RIGHT,
+};
+enum { FINGER_PINKY = 1, FINGER_RING, FINGER_MIDDLE, FINGER_INDEX, FINGER_THUMB };
+
+#define HF(hand, finger) ((hand) | (finger) << 2)
+#define HF_ROW(c0, c1, c2, c3, c4, c5)                                  \
+    ((uint32_t)(c0) | (uint32_t)(c1) << 5 | (uint32_t)(c2) << 10 |     \
+     (uint32_t)(c3) << 15 | (uint32_t)(c4) << 20 | (uint32_t)(c5) << 25)
+// A row of a half from the outer column in. The number row and the outer
+// column may be chorded with either hand.
+#define HF_ALPHA_ROW(hand)                                                         \
+    HF_ROW(HF(HAND_EITHER, FINGER_PINKY), HF(hand, FINGER_PINKY),                  \
+           HF(hand, FINGER_RING), HF(hand, FINGER_MIDDLE), HF(hand, FINGER_INDEX), \
+           HF(hand, FINGER_INDEX))
+#define HF_THUMB_ROW(hand)                                                 \
+    HF_ROW(HF(hand, FINGER_THUMB), HF(hand, FINGER_THUMB), HF(hand, FINGER_THUMB), \
+           HF(hand, FINGER_THUMB), HF(hand, FINGER_THUMB),                         \
+           HF(HAND_EITHER, FINGER_THUMB)) // Encoder key.
+
+_Static_assert(MATRIX_ROWS == 10 && MATRIX_COLS == 6, "hand_finger_rows is for a Sofle");
+static const uint32_t hand_finger_rows[MATRIX_ROWS] = {
+    // Left half.
+    HF_ALPHA_ROW(HAND_EITHER), // Number row.
+    HF_ALPHA_ROW(HAND_LEFT),
+    HF_ALPHA_ROW(HAND_LEFT),
+    HF_ALPHA_ROW(HAND_LEFT),
+    HF_THUMB_ROW(HAND_LEFT),
+    // Right half.
+    HF_ALPHA_ROW(HAND_EITHER), // Number row.
+    HF_ALPHA_ROW(HAND_RIGHT),
+    HF_ALPHA_ROW(HAND_RIGHT),
+    HF_ALPHA_ROW(HAND_RIGHT),
+    HF_THUMB_ROW(HAND_RIGHT),
+};
+
+// Gets the 5-bit hand and finger code of a key, or 0 if off the matrix, as
+// for combos.
+static uint8_t hand_finger(keypos_t key) {
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return 0;
+    }
+    return (hand_finger_rows[key.row] >> (5 * key.col)) & 0x1f;
+}
+#define HAND(code) ((code) & 3)
+#define FINGER(code) ((code) >> 2)
+
+char chordal_hold_handedness(keypos_t key) {
+    static const char hands[4] = {'*', 'L', 'R', '*'};
+    return hands[HAND(hand_finger(key))];
+}
+
 uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t* record,
                            uint16_t prev_keycode) {
     if (get_tap_keycode(prev_keycode) <= KC_Z &&
         (get_mods() & (MOD_MASK_CG | MOD_BIT_LALT)) == 0) {
-        switch (keycode) {
-            case HOME_A: case HOME_R: case HOME_I: case HOME_O:
+        switch (FINGER(hand_finger(record->event.key))) {
+            case FINGER_PINKY: case FINGER_RING:
                 return FLOW_TAP_TERM;      // 100ms for pinky/ring
-            case HOME_T: case HOME_N:
+            case FINGER_INDEX:
                 return FLOW_TAP_TERM - 25; // 75ms for index (ctrl)
         }
     }
@@ -472,15 +552,57 @@ bool get_speculative_hold(uint16_t keycode, keyrecord_t* record) {
     return true;
 }
 
-#ifdef AUTOCORRECT_ENABLE
+#if defined(AUTOCORRECT_ENABLE) || defined(AUTOCORRECTION_FLASH_ENABLE)
+static uint16_t unpack_tap_keycode(uint16_t keycode);
+
+// Sends the correction through the output queue. The generator already trims
+// the common prefix of typo and correction, so only the differing tail is
+// deleted and retyped.
 bool apply_autocorrect(uint8_t backspaces, const char* str, char* typo, char* correct) {
     for (uint8_t i = 0; i < backspaces; ++i) {
-        tap_code(KC_BSPC);
+        output_queue_tap_code(KC_BSPC);
+    }
+#ifdef AUTOCORRECTION_FLASH_ENABLE
+    // A correction recased by features/autocorrection.c is a copy in RAM.
+    const char* recased = autocorrection_get_recased();
+    if (recased) {
+        output_queue_send_string(recased);
+    } else {
+        output_queue_send_string_P(str);
+    }
+#else
+    output_queue_send_string_P(str);
+#endif // AUTOCORRECTION_FLASH_ENABLE
+
+#ifdef AUTOCORRECTION_FLASH_ENABLE
+    // features/autocorrection.c has already cased the correction like the
+    // typo. Send it now, without the Shift held to type the typo in caps, which
+    // would turn the ' in "DOESN'T" into ". QMK core's Autocorrect sends the
+    // dictionary's lowercase string, which needs the held Shift for caps.
+    const uint8_t shift = get_mods() & MOD_MASK_SHIFT;
+    if (shift) {
+        del_mods(shift);
+        output_queue_flush();
+        add_mods(shift);
+        return false;
+    }
+#endif // AUTOCORRECTION_FLASH_ENABLE
+
+    // Autocorrect swallows the letter that completed the typo, so the queue may
+    // drain at its pace. But a word break like the comma in "exprort," goes to
+    // the host right after this returns; send the correction before it.
+    switch (unpack_tap_keycode(get_last_keycode())) {
+        case KC_A ... KC_Z:
+            break;
+        case KC_QUOT: // " is a word break, ' is not.
+            if ((get_last_mods() & MOD_MASK_SHIFT) == 0) { break; }
+            // Fall through.
+        default:
+            output_queue_flush();
     }
-    send_string_with_delay_P(str, TAP_CODE_DELAY);
     return false;
 }
-#endif // AUTOCORRECT_ENABLE
+#endif // AUTOCORRECT_ENABLE || AUTOCORRECTION_FLASH_ENABLE
 
 bool caps_word_press_user(uint16_t keycode) {
     switch (keycode) {
@@ -509,6 +631,7 @@ bool caps_word_press_user(uint16_t keycode) {
         case M_JECT:
         case M_KEYWORD:
         case M_XPORT:
+        case M_TRIGRAM:
             return true;
 
         default:
@@ -516,17 +639,6 @@ bool caps_word_press_user(uint16_t keycode) {
     }
 }
 
-// Chordal Hold layout: maps each key position to 'L' (left), 'R' (right),
-// or '*' (either hand). Used by QMK's Chordal Hold to determine opposite-hand
-// holds, replacing Achordion.
-const char chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] PROGMEM = LAYOUT(
-  '*', '*', '*', '*', '*', '*',                        '*', '*', '*', '*', '*', '*',
-  '*', 'L', 'L', 'L', 'L', 'L',                       'R', 'R', 'R', 'R', 'R', '*',
-  '*', 'L', 'L', 'L', 'L', 'L',                       'R', 'R', 'R', 'R', 'R', '*',
-  '*', 'L', 'L', 'L', 'L', 'L', '*',             '*', 'R', 'R', 'R', 'R', 'R', '*',
-            'L', 'L', 'L', 'L', 'L',              'R', 'R', 'R', 'R', 'R'
-);
-
 bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t* tap_hold_record,
                       uint16_t other_keycode, keyrecord_t* other_record) {
     // Layer-tap keys always hold.
@@ -538,101 +650,133 @@ bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t* tap_hold_record,
             return true;
     }
 
+    // Combos and other non-key events have no hand; hold, as QMK's default does.
+    if (!IS_KEYEVENT(tap_hold_record->event) || !IS_KEYEVENT(other_record->event)) {
+        return true;
+    }
+
+    const uint8_t other = hand_finger(other_record->event.key);
     // Thumb row: allow same-hand holds.
-    if (other_record->event.key.row % (MATRIX_ROWS / 2) >= 4) {
+    if (FINGER(other) == FINGER_THUMB) {
         return true;
     }
+    // Otherwise hold only with the opposite hand, or a key for either hand.
+    return (HAND(hand_finger(tap_hold_record->event.key)) | HAND(other)) == HAND_EITHER;
+}
 
-    return get_chordal_hold_default(tap_hold_record, other_record);
+// Unpacks the tapping keycode of tap-hold keys.
+static uint16_t unpack_tap_keycode(uint16_t keycode) {
+    switch (keycode) {
+#ifndef NO_ACTION_TAPPING
+        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+            return QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+#    ifndef NO_ACTION_LAYER
+        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+            return QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+#    endif // NO_ACTION_LAYER
+#endif     // NO_ACTION_TAPPING
+    }
+    return keycode;
 }
 
+// Completion for M_TRIGRAM, found by get_alt_repeat_key_keycode_user().
+static const char* magic_trigram_text = NULL;
+
+// Alternate Repeat ("magic") key, indexed by the tap keycode of the last key
+// and whether Shift was held with it. QMK unpacks modified keycodes like
+// KC_HASH into a basic keycode and Shift before we see them, so # is [KC_3]
+// shifted. Entries left at KC_TRNS defer to QMK's default alternate keys.
 // clang-format off
+static const uint16_t magic_keys[256][2] PROGMEM = {
+    [0 ... 0xff] = {KC_TRNS, KC_TRNS},
+    //            Unshifted    Shifted
+    // For navigating next/previous search results in Vim:
+    // N -> Shift + N, Shift + N -> N.
+    [KC_N]    = {S(KC_N),    KC_N},
+
+    // Behavior for Magic Sturdy's "magic" key.
+    [KC_A]    = {KC_O,       KC_O},       // A -> O
+    [KC_C]    = {KC_Y,       KC_Y},       // C -> Y
+    [KC_D]    = {KC_Y,       KC_Y},       // D -> Y
+    [KC_E]    = {KC_U,       KC_U},       // E -> U
+    [KC_G]    = {KC_Y,       KC_Y},       // G -> Y
+    [KC_L]    = {KC_K,       KC_K},       // L -> K
+    [KC_M]    = {M_MENT,     M_MENT},     // M -> ENT
+    [KC_O]    = {KC_A,       KC_A},       // O -> A
+    [KC_P]    = {KC_Y,       KC_Y},       // P -> Y
+    [KC_Q]    = {M_QUEN,     M_QUEN},     // Q -> UEN
+    [KC_R]    = {KC_L,       KC_L},       // R -> L
+    [KC_S]    = {KC_K,       KC_K},       // S -> K
+    [KC_T]    = {M_TMENT,    M_TMENT},    // T -> TMENT
+    [KC_U]    = {KC_E,       KC_E},       // U -> E
+    [KC_Y]    = {KC_P,       KC_P},       // Y -> P
+    [KC_SPC]  = {M_THE,      M_THE},      // spc -> THE
+
+    // Coding completions via magic key.
+    [KC_F]    = {M_FUNC,     M_FUNC},     // F * -> function
+    [KC_B]    = {M_BREAK,    M_BREAK},    // B * -> break
+    [KC_I]    = {M_IMPORT,   M_IMPORT},   // I * -> import
+    [KC_H]    = {M_HANDLER,  M_HANDLER},  // H * -> handler
+    [KC_J]    = {M_JECT,     M_JECT},     // J * -> ject
+    [KC_K]    = {M_KEYWORD,  M_KEYWORD},  // K * -> keyword
+    [KC_V]    = {M_VALUE,    M_VALUE},    // V * -> value
+    [KC_W]    = {M_WHILE,    M_WHILE},    // W * -> while
+    [KC_X]    = {M_XPORT,    M_XPORT},    // X * -> xport
+
+    [KC_DOT]  = {M_UPDIR,    M_UPDIR},    // . -> ./
+    [KC_COMM] = {KC_NO,      M_EQEQ},     // ! -> == (! is Shift + , here)
+    [KC_EQL]  = {M_EQEQ,     M_EQEQ},     // = -> ==
+    [KC_3]    = {KC_TRNS,    M_INCLUDE},  // # -> include
+    [KC_QUOT] = {KC_NO,      M_DOCSTR},   // " -> ""<cursor>"""
+    [KC_GRV]  = {M_MKGRVS,   M_MKGRVS},   // ` -> ``<cursor>``` (for Markdown code)
+};
+
+// Exceptions to magic_keys, looked up by the last keycode as is, or with Ctrl
+// folded in as C(tap keycode) when Ctrl was held.
+static const struct {
+    uint16_t keycode;
+    uint16_t alt_keycode;
+} magic_overflow[] PROGMEM = {
+    // Plain N, as on GAMER and after "OAN", repeats as itself.
+    {KC_N,      KC_N},
+    // Select word direction toggle.
+    {SELWORD,   SELWBAK},
+    {SELWBAK,   SELWORD},
+    {C(KC_A),   C(KC_C)},  // Ctrl+A -> Ctrl+C
+};
+// clang-format on
+
 uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
-  if ((mods & ~MOD_MASK_SHIFT) == 0) {
-    switch (keycode) {
-      // For navigating next/previous search results in Vim:
-      // N -> Shift + N, Shift + N -> N.
-      case HOME_N:
-        if ((mods & MOD_MASK_SHIFT) == 0) {
-          return S(KC_N);
-        }
-        // Fall through intended.
-      case KC_N: return KC_N;
-
-      // Behavior for Magic Sturdy's "magic" key.
-      case HOME_A: return KC_O;        // A -> O
-      case KC_C: return KC_Y;         // C -> Y
-		  case KC_D: return KC_Y;         // D -> Y
-      case HOME_E: return KC_U;       // E -> U
-      case KC_G: return KC_Y;         // G -> Y
-      case KC_L: return KC_K;         // L -> K
-      case KC_M: return M_MENT;       // M -> ENT
-      case KC_O: return KC_A;         // O -> A
-      case KC_P: return KC_Y;         // P -> Y
-      case KC_Q: return M_QUEN;       // Q -> UEN
-      case HOME_R: return KC_L;       // R -> L
-      case HOME_S: return KC_K;       // S -> K
-      case HOME_T: return M_TMENT;    // T -> TMENT
-      case KC_U: return KC_E;         // U -> E
-      case KC_Y: return KC_P;         // Y -> P
-      case KC_SPC: return M_THE;      // spc -> THE
-
-      // Coding completions via magic key.
-      case KC_F: return M_FUNC;       // F * -> function
-      case KC_B: return M_BREAK;      // B * -> break
-      case HOME_I: return M_IMPORT;   // I * -> import
-      case KC_H: return M_HANDLER;    // H * -> handler
-      case KC_J: return M_JECT;       // J * -> ject
-      case KC_K: return M_KEYWORD;    // K * -> keyword
-      case KC_V: return M_VALUE;      // V * -> value
-      case KC_W: return M_WHILE;      // W * -> while
-      case KC_X: return M_XPORT;      // X * -> xport
-
-      // Select word direction toggle.
-      case SELWORD: return SELWBAK;
-      case SELWBAK: return SELWORD;
-
-      case KC_DOT: return M_UPDIR;    // . -> ./
-      case KC_COMM:                   // ! -> ==
-        if ((mods & MOD_MASK_SHIFT) == 0) {
-          return KC_NO;
+    const bool ctrl = (mods & MOD_MASK_CTRL) != 0;
+    if (!ctrl && (mods & ~MOD_MASK_SHIFT) != 0) {
+        return KC_TRNS;
+    }
+
+    const uint16_t tap_keycode = unpack_tap_keycode(keycode);
+    if (!ctrl) { // Completions from context come before magic_keys.
+        const char* text = magic_trigrams_lookup(tap_keycode);
+        if (text) {
+            magic_trigram_text = text;
+            return M_TRIGRAM;
         }
-        // Fall through intended.
-      case KC_EQL: return M_EQEQ;     // = -> ==
-      case KC_HASH: return M_INCLUDE; // # -> include
-      case KC_QUOT:
-        if ((mods & MOD_MASK_SHIFT) != 0) {
-          return M_DOCSTR;  // " -> ""<cursor>"""
+    }
+
+    const uint16_t key = ctrl ? (tap_keycode <= 0xff ? C(tap_keycode) : KC_NO) : keycode;
+    for (uint8_t i = 0; i < ARRAY_SIZE(magic_overflow); ++i) {
+        if (key == pgm_read_word(&magic_overflow[i].keycode)) {
+            return pgm_read_word(&magic_overflow[i].alt_keycode);
         }
-        return KC_NO;
-      case KC_GRV:  // ` -> ``<cursor>``` (for Markdown code)
-        return M_MKGRVS;
-      case KC_LABK: return KC_MINS;   // < -> - (for Haskell)
     }
-  } else if ((mods & MOD_MASK_CTRL)) {
-    switch (keycode) {
-      case HOME_A:  // Ctrl+A -> Ctrl+C
-        return C(KC_C);
+
+    if (ctrl || tap_keycode > 0xff) {
+        return KC_TRNS;
     }
-  }
-  return KC_TRNS;
+    return pgm_read_word(&magic_keys[tap_keycode][(mods & MOD_MASK_SHIFT) != 0]);
 }
-// clang-format on
 
 bool remember_last_key_user(uint16_t keycode, keyrecord_t* record, uint8_t* remembered_mods) {
-    // Unpack tapping keycode for tap-hold keys.
-    switch (keycode) {
-#ifndef NO_ACTION_TAPPING
-        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
-            keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
-            break;
-#    ifndef NO_ACTION_LAYER
-        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
-            keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
-            break;
-#    endif // NO_ACTION_LAYER
-#endif     // NO_ACTION_TAPPING
-    }
+    keycode = unpack_tap_keycode(keycode);
+    magic_trigrams_record(keycode);
 
     // Forget Shift on letters when Shift or AltGr are the only mods.
     // Exceptionally, I want Shift remembered on N and Z for "NN" and "ZZ" in Vim.
@@ -650,47 +794,257 @@ bool remember_last_key_user(uint16_t keycode, keyrecord_t* record, uint8_t* reme
 
 // An enhanced version of SEND_STRING: if Caps Word is active, the Shift key is
 // held while sending the string. Additionally, the last key is set such that if
-// the Repeat Key is pressed next, it produces `repeat_keycode`.
+// the Repeat Key is pressed next, it produces `repeat_keycode`. The string goes
+// through the output queue, so this returns without waiting for it to be typed.
 #define MAGIC_STRING(str, repeat_keycode) magic_send_string_P(PSTR(str), (repeat_keycode))
 static void magic_send_string_P(const char* str, uint16_t repeat_keycode) {
-    uint8_t saved_mods = 0;
-    // If Caps Word is on, save the mods and hold Shift.
-    if (is_caps_word_on()) {
-        saved_mods = get_mods();
-        register_mods(MOD_BIT(KC_LSFT));
-    }
+    // If Caps Word is on, hold Shift unless it is already held.
+    const uint8_t shift = is_caps_word_on() ? (MOD_BIT(KC_LSFT) & ~get_mods()) : 0;
+
+    if (shift) { output_queue_register_mods(shift); }
+    output_queue_send_string_P(str); // Queue the string.
+    if (shift) { output_queue_unregister_mods(shift); }
 
-    send_string_with_delay_P(str, TAP_CODE_DELAY); // Send the string.
+    magic_trigrams_record_string_P(str);
     set_last_keycode(repeat_keycode);
+}
+
+// Stages of process_record_user() timed by Latency Stats, when enabled in
+// rules.mk. The LATENCY key prints them to the console, or clears them when
+// shifted.
+enum latency_stages {
+    LATENCY_SOCD_CLEANER,
+    LATENCY_ORBITAL_MOUSE,
+    LATENCY_SENTENCE_CASE,
+    LATENCY_SELECT_WORD,
+    LATENCY_CUSTOM_SHIFT_KEYS,
+    LATENCY_MOUSE_TURBO_CLICK,
+    LATENCY_OS_WORD,
+    LATENCY_MACROS,
+    NUM_LATENCY_STAGES,
+};
+
+#ifdef LATENCY_STATS_ENABLE
+_Static_assert(NUM_LATENCY_STAGES <= LATENCY_STATS_NUM_STAGES,
+               "Increase LATENCY_STATS_NUM_STAGES in config.h");
+
+static const char* const latency_stage_names[] = {
+    "socd_cleaner",
+    "orbital_mouse",
+    "sentence_case",
+    "select_word",
+    "custom_shift_keys",
+    "mouse_turbo_click",
+    "os_word",
+    "macros",
+};
+#endif  // LATENCY_STATS_ENABLE
+
+// Handlers in the feature chain at the top of process_record_user(), as bits.
+enum {
+    HANDLER_SOCD_CLEANER      = 1 << 0,
+    HANDLER_ORBITAL_MOUSE     = 1 << 1,
+    HANDLER_SENTENCE_CASE     = 1 << 2,
+    HANDLER_SELECT_WORD       = 1 << 3,
+    HANDLER_CUSTOM_SHIFT_KEYS = 1 << 4,
+    HANDLER_MOUSE_TURBO_CLICK = 1 << 5,
+};
+
+// Handlers that act on each basic keycode. Keep in sync with socd_v, socd_h
+// and custom_shift_keys.
+// clang-format off
+static const uint8_t basic_keycode_handlers[256] PROGMEM = {
+    [KC_W] = HANDLER_SOCD_CLEANER,
+    [KC_A] = HANDLER_SOCD_CLEANER,
+    [KC_S] = HANDLER_SOCD_CLEANER,
+    [KC_D] = HANDLER_SOCD_CLEANER,
+    [MS_UP ... MS_ACL2] = HANDLER_ORBITAL_MOUSE,
+    [KC_DOT]  = HANDLER_CUSTOM_SHIFT_KEYS,
+    [KC_COMM] = HANDLER_CUSTOM_SHIFT_KEYS,
+};
+// clang-format on
+
+// Handlers enabled on the active layers, updated in layer_state_set_user().
+static uint8_t layer_handlers = (uint8_t)~HANDLER_SOCD_CLEANER;
+// Handlers whose last event was one of their own keys. They also get the next
+// event of any key: Custom Shift Keys to release its shifted keycode, Mouse
+// Turbo Click to cancel a pending double tap.
+static uint8_t armed_handlers = 0;
+
+static uint8_t keycode_handlers(uint16_t keycode) {
+    if (keycode <= 0xff) {
+        return pgm_read_byte(&basic_keycode_handlers[keycode]);
+    }
+    if (ORBITAL_MOUSE_KEYCODE_RANGE_START <= keycode &&
+        keycode <= ORBITAL_MOUSE_KEYCODE_RANGE_END) {
+        return HANDLER_ORBITAL_MOUSE;
+    }
+    switch (keycode) {
+        case SELWORD: return HANDLER_SELECT_WORD;
+        case TURBO:   return HANDLER_MOUSE_TURBO_CLICK;
+    }
+    return 0;
+}
+
+// Gets the handlers to visit for an event, given its keycode's handlers.
+static uint8_t handlers_for_event(uint8_t own, keyrecord_t* record) {
+    uint8_t handlers = own | armed_handlers;
+    // Sentence Case sees every press, to track what was typed.
+    if (record->event.pressed) { handlers |= HANDLER_SENTENCE_CASE; }
+    // Select Word sees every event while selecting, any of which may end it.
+    if (is_select_word_active()) { handlers |= HANDLER_SELECT_WORD; }
+    return handlers & layer_handlers;
+}
 
-    // If Caps Word is on, restore the mods.
-    if (is_caps_word_on()) {
-        set_mods(saved_mods);
+// Called as an armable handler visits an event, given its keycode's handlers.
+static void arm_handler(uint8_t handler, uint8_t own) {
+    if (own & handler) {
+        armed_handlers |= handler;
+    } else {
+        armed_handlers &= ~handler;
     }
 }
 
+// Vim, tmux and Harpoon macros as bytecode programs (see
+// features/macro_bytecode.h). Each program is a member of one PROGMEM struct,
+// so that a keycode finds its program through a 16-bit offset.
+// clang-format off
+#define BYTECODE_MACROS(X) \
+    /* Vim */ \
+    X(MC_COMMENT,           BC_TAP(X_ESC) " /") \
+    X(MC_CPR,               BC_TAP(X_ESC) ":%s///g" BC_TAP(X_LEFT) BC_TAP(X_LEFT) BC_TAP(X_LEFT)) \
+    X(MC_SAVE,              BC_TAP(X_ESC) ":w" BC_TAP(X_ENT)) \
+    X(MC_DELETE_WORD,       "diw") \
+    X(MC_QUIT,              BC_TAP(X_ESC) ":q" BC_TAP(X_ENT)) \
+    X(MC_VISTA,             BC_TAP(X_ESC) ":Vista!!" BC_TAP(X_ENT)) \
+    X(MC_NEXT_TAB,          BC_TAP(X_ESC) ":tabnext" BC_TAP(X_ENT)) \
+    X(MC_PREV_TAB,          BC_TAP(X_ESC) ":tabprevious" BC_TAP(X_ENT)) \
+    X(MC_BUFFERS,           BC_TAP(X_ESC) ":lua require(\" user.bfs\").open()" BC_TAP(X_ENT)) \
+    X(MC_SPLIT_HELPER,      BC_LGUI(X_K)) \
+    X(MC_SELECT_WORD,       "viw") \
+    /* Tmux */ \
+    X(MC_TMUX_PREV,         BC_LCTL(X_B) "p") \
+    X(MC_TMUX_NEXT,         BC_LCTL(X_B) "n") \
+    X(MC_TMUX_SPLIT_H,      BC_LCTL(X_B) "h") \
+    X(MC_TMUX_SPLIT_V,      BC_LCTL(X_B) "v") \
+    X(MC_TMUX_RELOAD,       BC_LCTL(X_B) "r") \
+    X(MC_TMUX_RENAME,       BC_LCTL(X_B) ",") \
+    X(MC_TMUX_SWITCH_UP,    BC_LCTL(X_B) BC_TAP(X_UP)) \
+    X(MC_TMUX_SWITCH_DOWN,  BC_LCTL(X_B) BC_TAP(X_DOWN)) \
+    X(MC_TMUX_SWITCH_LEFT,  BC_LCTL(X_B) BC_TAP(X_LEFT)) \
+    X(MC_TMUX_SWITCH_RIGHT, BC_LCTL(X_B) BC_TAP(X_RGHT)) \
+    X(MC_TMUX_KILL_SESSION, BC_LCTL(X_B) "q") \
+    X(MC_TMUX_KILL_PANE,    BC_LCTL(X_B) "w") \
+    X(MC_TMUX_NEW,          BC_LCTL(X_B) "c") \
+    X(MC_TMUX_INSTALL,      BC_LCTL(X_B) "U") \
+    X(MC_TMUX_DETACH,       BC_LCTL(X_B) "d") \
+    X(MC_TMUX_SAVE,         BC_LCTL(X_B) BC_LCTL(X_S)) \
+    X(MC_TMUX_RESTORE,      BC_LCTL(X_B) BC_LCTL(X_R)) \
+    X(MC_TMUX_CHSH,         BC_LCTL(X_B) "i") \
+    X(MC_TMUX_SESSIONIZER,  BC_LCTL(X_B) "f") \
+    X(MC_TMUX_SESSIONS,     BC_LCTL(X_B) "s") \
+    /* Harpoon (uses nvim leader shortcuts) */ \
+    X(MC_HARPOON_PREV,      BC_TAP(X_ESC) ",") \
+    X(MC_HARPOON_NEXT,      BC_TAP(X_ESC) ".") \
+    X(MC_HARPOON_GOTO_1,    BC_TAP(X_ESC) " h1") \
+    X(MC_HARPOON_GOTO_2,    BC_TAP(X_ESC) " h2") \
+    X(MC_HARPOON_GOTO_3,    BC_TAP(X_ESC) " h3") \
+    X(MC_HARPOON_GOTO_4,    BC_TAP(X_ESC) " h4") \
+    X(MC_HARPOON_GOTO_5,    BC_TAP(X_ESC) " h5") \
+    X(MC_HARPOON_ADD,       BC_TAP(X_ESC) " ha") \
+    X(MC_HARPOON_MENU,      BC_TAP(X_ESC) " hh") \
+    /* Nvim */ \
+    X(MC_FIND_FILES,        BC_TAP(X_ESC) " ff") \
+    X(MC_GREP_TEXT,         BC_TAP(X_ESC) " ft") \
+    X(MC_LSP_FORMAT,        BC_TAP(X_ESC) " lf") \
+    X(MC_LSP_ACTION,        BC_TAP(X_ESC) " la") \
+    X(MC_LSP_RENAME,        BC_TAP(X_ESC) " ln") \
+    X(MC_GIT_STAGE,         BC_TAP(X_ESC) " gs") \
+    X(MC_GIT_BLAME,         BC_TAP(X_ESC) " gb") \
+    /* Tmux */ \
+    X(MC_TMUX_ZOOM,         BC_LCTL(X_B) "z") \
+    X(MC_TMUX_COPY_MODE,    BC_LCTL(X_B) "[") \
+    X(MC_TMUX_LAST_WINDOW,  BC_LCTL(X_B) "l") \
+    /* Pane navigation */ \
+    X(MC_PANE_LEFT,         BC_LCTL(X_W) "h") \
+    X(MC_PANE_DOWN,         BC_LCTL(X_W) "j") \
+    X(MC_PANE_UP,           BC_LCTL(X_W) "k") \
+    X(MC_PANE_RIGHT,        BC_LCTL(X_W) "l")
+
+static const struct {
+    char start[0];
+#define X(keycode, program) char keycode[sizeof(program)];
+    BYTECODE_MACROS(X)
+#undef X
+} macro_programs PROGMEM = {
+#define X(keycode, program) .keycode = program,
+    BYTECODE_MACROS(X)
+#undef X
+};
+
+static const uint16_t macro_offsets[] PROGMEM = {
+#define X(keycode, program) [keycode - MC_COMMENT] = offsetof(__typeof__(macro_programs), keycode),
+    BYTECODE_MACROS(X)
+#undef X
+};
+// clang-format on
+
+_Static_assert(sizeof(macro_offsets) / sizeof(*macro_offsets) == MC_PANE_RIGHT - MC_COMMENT + 1,
+               "BYTECODE_MACROS must have one entry per keycode from MC_COMMENT to MC_PANE_RIGHT");
+
 // clang-format off
 bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+  // Send queued macro output first, so that it stays ordered before this key.
+  if (!process_output_queue(keycode, record)) { return false; }
+  // Keys typed by Repeat and Alternate Repeat aren't remembered by
+  // remember_last_key_user(), so add them to the magic key's context here.
+  if (get_repeat_key_count() != 0 && record->event.pressed) {
+    magic_trigrams_record(unpack_tap_keycode(keycode));
+  }
+  // Decode the event once for the text features: Sentence Case, Select Word
+  // and autocorrection, and add its key to the text history they share.
+  text_event_t text_event;
+  text_event_normalize(&text_event, keycode, record);
+  text_history_append(&text_event, record);
+  // Feature handlers, visiting only those that can act on this event.
+  const uint8_t own_handlers = keycode_handlers(keycode);
+  const uint8_t handlers = handlers_for_event(own_handlers, record);
   // 1. SOCD Cleaner (gaming input filtering)
-  if (!process_socd_cleaner(keycode, record, &socd_v)) { return false; }
-  if (!process_socd_cleaner(keycode, record, &socd_h)) { return false; }
+  if (handlers & HANDLER_SOCD_CLEANER) {
+    LATENCY_STATS_SCOPE(LATENCY_SOCD_CLEANER);
+    if (!process_socd_cleaner(keycode, record, &socd_v)) { return false; }
+    if (!process_socd_cleaner(keycode, record, &socd_h)) { return false; }
+  }
   // 2. Orbital Mouse
-  if (!process_orbital_mouse(keycode, record)) { return false; }
+  if (handlers & HANDLER_ORBITAL_MOUSE) {
+    LATENCY_STATS_SCOPE(LATENCY_ORBITAL_MOUSE);
+    if (!process_orbital_mouse(keycode, record)) { return false; }
+  }
   // 3. Sentence Case
-  if (!process_sentence_case(keycode, record)) { return false; }
+  if (handlers & HANDLER_SENTENCE_CASE) {
+    LATENCY_STATS_SCOPE(LATENCY_SENTENCE_CASE);
+    if (!process_sentence_case_event(&text_event, record)) { return false; }
+  }
   // 4. Select Word
-  if (!process_select_word(keycode, record)) { return false; }
+  if (handlers & HANDLER_SELECT_WORD) {
+    LATENCY_STATS_SCOPE(LATENCY_SELECT_WORD);
+    if (!process_select_word_event(&text_event, keycode, record)) { return false; }
+  }
   // 5. Custom Shift Keys
-  if (!process_custom_shift_keys(keycode, record)) { return false; }
+  if (handlers & HANDLER_CUSTOM_SHIFT_KEYS) {
+    LATENCY_STATS_SCOPE(LATENCY_CUSTOM_SHIFT_KEYS);
+    arm_handler(HANDLER_CUSTOM_SHIFT_KEYS, own_handlers);
+    if (!process_custom_shift_keys(keycode, record)) { return false; }
+  }
   // 6. Mouse Turbo Click
-  if (!process_mouse_turbo_click(keycode, record, TURBO)) { return false; }
+  if (handlers & HANDLER_MOUSE_TURBO_CLICK) {
+    LATENCY_STATS_SCOPE(LATENCY_MOUSE_TURBO_CLICK);
+    arm_handler(HANDLER_MOUSE_TURBO_CLICK, own_handlers);
+    if (!process_mouse_turbo_click(keycode, record, TURBO)) { return false; }
+  }
 
   const uint8_t mods = get_mods();
-  const bool shifted = (mods | get_weak_mods()
-#ifndef NO_ACTION_ONESHOT
-                        | get_oneshot_mods()
-#endif  // NO_ACTION_ONESHOT
-                       ) & MOD_MASK_SHIFT;
+  const bool shifted = text_event.mods & MOD_MASK_SHIFT;
 
   // If alt repeating a key A-Z with no mods other than Shift, set the last key
   // to KC_N. Above, alternate repeat of KC_N is defined to be again KC_N. This
@@ -708,7 +1062,8 @@ bool process_record_user(uint16_t keycode, keyrecord_t* record) {
 
   // OS-aware word navigation: Alt on macOS, Ctrl on Win/Linux.
   {
-    uint16_t mod = (detected_host_os() == OS_MACOS) ? KC_LALT : KC_LCTL;
+    LATENCY_STATS_SCOPE(LATENCY_OS_WORD);
+    const uint8_t mod = os_profile->word_mod;
     switch (keycode) {
       case OS_WORD_LEFT:
         if (record->event.pressed) { register_code(mod); register_code(KC_LEFT); }
@@ -742,35 +1097,51 @@ bool process_record_user(uint16_t keycode, keyrecord_t* record) {
   }
 
   if (record->event.pressed) {
+    LATENCY_STATS_SCOPE(LATENCY_MACROS);
+    if (MC_COMMENT <= keycode && keycode <= MC_PANE_RIGHT) {
+      macro_bytecode_run_P(macro_programs.start +
+                           pgm_read_word(&macro_offsets[keycode - MC_COMMENT]));
+      return false;
+    }
+
     switch (keycode) {
+        case LATENCY:
+#ifdef LATENCY_STATS_ENABLE
+        if (shifted) {
+          latency_stats_reset();
+        } else {
+          latency_stats_print(latency_stage_names);
+        }
+#endif  // LATENCY_STATS_ENABLE
+        return false;
+
         case EXIT:
         layer_off(MAINTENANCE);
         return false;
 
         case SCOPE:
-        SEND_STRING("::");
+        QUEUE_STRING("::");
         return false;
 
         case UPDIR:
-        SEND_STRING("../");
+        QUEUE_STRING("../");
         return false;
 
         case TMUXESC:  // Enter copy mode in Tmux.
-        SEND_STRING(SS_LCTL("a") SS_TAP(X_ESC));
+        QUEUE_STRING(SS_LCTL("a") SS_TAP(X_ESC));
         return false;
 
         case SRCHSEL:  // Searches the current selection in a new tab.
-        // Mac users, change LCTL to LGUI.
-        SEND_STRING(SS_LGUI("ct") SS_DELAY(100) SS_LGUI("v") SS_TAP(X_ENTER));
+        output_queue_send_string_P(os_profile->search_selection);
         return false;
 
         case USRNAME: {  // Type my username, or if Shift is held, my last name.
         static const char username[] PROGMEM = "arturgoms";
         static const char last_name[] PROGMEM = "Gomes";
         clear_weak_mods();
-        unregister_mods(mods);  // Clear mods before send_string.
-        send_string_P(shifted ? last_name : username);
-        register_mods(mods);  // Restore mods.
+        output_queue_unregister_mods(mods);  // Clear mods before the string.
+        output_queue_send_string_P(shifted ? last_name : username);
+        output_queue_register_mods(mods);  // Restore mods.
         } break;
 
         // The following cases type a few Unicode symbols.
@@ -800,316 +1171,48 @@ bool process_record_user(uint16_t keycode, keyrecord_t* record) {
 				case M_TMENT:   MAGIC_STRING(/*t*/"ment", KC_S); break;
 				case M_THE:     MAGIC_STRING(/* */"the", KC_N); break;
 				case M_UPDIR:   MAGIC_STRING(/*.*/"./", UPDIR); break;
-				case M_INCLUDE: SEND_STRING_DELAY(/*#*/"include ", TAP_CODE_DELAY); break;
-				case M_EQEQ:    SEND_STRING_DELAY(/*=*/"==", TAP_CODE_DELAY); break;
+				case M_INCLUDE: QUEUE_STRING(/*#*/"include "); break;
+				case M_EQEQ:    QUEUE_STRING(/*=*/"=="); break;
 				case M_DOCSTR:
-					SEND_STRING_DELAY(/*"*/"\"\"\"\"\""
-							SS_TAP(X_LEFT) SS_TAP(X_LEFT) SS_TAP(X_LEFT), TAP_CODE_DELAY);
+					QUEUE_STRING(/*"*/"\"\"\"\"\""
+							SS_TAP(X_LEFT) SS_TAP(X_LEFT) SS_TAP(X_LEFT));
 					break;
 				case M_MKGRVS:
-					SEND_STRING_DELAY(/*`*/"``\n\n```" SS_TAP(X_UP), TAP_CODE_DELAY);
+					QUEUE_STRING(/*`*/"``\n\n```" SS_TAP(X_UP));
 					break;
 				// Coding completions via magic key.
 				case M_FUNC:    MAGIC_STRING(/*f*/"unction", KC_S); break;
 				case M_IMPORT:  MAGIC_STRING(/*i*/"mport", KC_S); break;
 				case M_BREAK:   MAGIC_STRING(/*b*/"reak", KC_S); break;
-				case M_WHILE:   SEND_STRING_DELAY(/*w*/"hile", TAP_CODE_DELAY); break;
+				case M_WHILE:   QUEUE_STRING(/*w*/"hile"); break;
 				case M_VALUE:   MAGIC_STRING(/*v*/"alue", KC_S); break;
 				case M_HANDLER: MAGIC_STRING(/*h*/"andler", KC_S); break;
 				case M_JECT:    MAGIC_STRING(/*j*/"ect", KC_S); break;
 				case M_KEYWORD: MAGIC_STRING(/*k*/"eyword", KC_S); break;
 				case M_XPORT:   MAGIC_STRING(/*x*/"port", KC_S); break;
-
-        // Vim
-        case MC_CPR:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(":%s///g");
-            SEND_STRING(SS_TAP(X_LEFT) SS_TAP(X_LEFT) SS_TAP(X_LEFT));
-            return false;
-
-        case MC_COMMENT:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" /");
-            return false;
-
-        case MC_SELECT_WORD:
-            tap_code(KC_V);
-            tap_code(KC_I);
-            tap_code(KC_W);
-            return false;
-
-        case MC_DELETE_WORD:
-            tap_code(KC_D);
-            tap_code(KC_I);
-            tap_code(KC_W);
-            return false;
-
-        case MC_SAVE:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(":w");
-            tap_code(KC_ENT);
-            return false;
-
-        case MC_QUIT:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(":q");
-            tap_code(KC_ENT);
-            return false;
-
-        case MC_VISTA:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(":Vista!!");
-            tap_code(KC_ENT);
-            return false;
-
-        case MC_NEXT_TAB:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(":tabnext");
-            tap_code(KC_ENT);
-            return false;
-
-        case MC_PREV_TAB:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(":tabprevious");
-            tap_code(KC_ENT);
-            return false;
-
-        case MC_BUFFERS:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(":lua require(\" user.bfs\").open()");
-            tap_code(KC_ENT);
-            return false;
-
-        case MC_SPLIT_HELPER:
-            tap_code16(LGUI(KC_K));
-            return false;
-
-        // Tmux
-
-        case MC_TMUX_NEXT:
-            tap_code16(LCTL(KC_B));
-            SEND_STRING("n");
-            return false;
-
-        case MC_TMUX_PREV:
-            tap_code16(LCTL(KC_B));
-            SEND_STRING("p");
-            return false;
-
-        case MC_TMUX_SPLIT_H:
-            tap_code16(LCTL(KC_B));
-            tap_code16(KC_H);
-            return false;
-
-        case MC_TMUX_SPLIT_V:
-            tap_code16(LCTL(KC_B));
-            tap_code16(KC_V);
-            return false;
-
-        case MC_TMUX_RELOAD:
-            tap_code16(LCTL(KC_B));
-            tap_code16(KC_R);
-            return false;
-
-        case MC_TMUX_RENAME:
-            tap_code16(LCTL(KC_B));
-            tap_code16(KC_COMM);
-            return false;
-
-        case MC_TMUX_SWITCH_UP:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_UP);
-            return false;
-
-        case MC_TMUX_SWITCH_DOWN:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_DOWN);
-            return false;
-
-        case MC_TMUX_SWITCH_LEFT:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_LEFT);
-            return false;
-
-        case MC_TMUX_SWITCH_RIGHT:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_RGHT);
-            return false;
-
-        case MC_TMUX_KILL_SESSION:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_Q);
-            return false;
-
-        case MC_TMUX_KILL_PANE:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_W);
-            return false;
-
-        case MC_TMUX_NEW:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_C);
-            return false;
-
-        case MC_TMUX_INSTALL:
-            tap_code16(LCTL(KC_B));
-            tap_code16(LSFT(KC_U));
-            return false;
-
-        case MC_TMUX_DETACH:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_D);
-            return false;
-
-        case MC_TMUX_SAVE:
-            tap_code16(LCTL(KC_B));
-            tap_code16(LCTL(KC_S));
-            return false;
-
-        case MC_TMUX_CHSH:
-            tap_code16(LCTL(KC_B));
-            tap_code16(KC_I);
-            return false;
-
-        case MC_TMUX_SESSIONIZER:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_F);
-            return false;
-
-        case MC_TMUX_SESSIONS:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_S);
-            return false;
-
-        case MC_TMUX_RESTORE:
-              tap_code16(LCTL(KC_B));
-              tap_code16(LCTL(KC_R));
-              return false;
-
-        case MC_TMUX_ZOOM:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_Z);
-            return false;
-
-        case MC_TMUX_COPY_MODE:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_LBRC);
-            return false;
-
-        case MC_TMUX_LAST_WINDOW:
-            tap_code16(LCTL(KC_B));
-            tap_code(KC_L);
-            return false;
-
-        // Pane navigation (C-w + direction)
-        case MC_PANE_LEFT:
-            tap_code16(LCTL(KC_W));
-            tap_code(KC_H);
-            return false;
-
-        case MC_PANE_DOWN:
-            tap_code16(LCTL(KC_W));
-            tap_code(KC_J);
-            return false;
-
-        case MC_PANE_UP:
-            tap_code16(LCTL(KC_W));
-            tap_code(KC_K);
-            return false;
-
-        case MC_PANE_RIGHT:
-            tap_code16(LCTL(KC_W));
-            tap_code(KC_L);
-            return false;
-
-        // Nvim macros (3+ keystroke sequences)
-        case MC_FIND_FILES:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" ff");
-            return false;
-
-        case MC_GREP_TEXT:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" ft");
-            return false;
-
-        case MC_LSP_FORMAT:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" lf");
-            return false;
-
-        case MC_LSP_ACTION:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" la");
-            return false;
-
-        case MC_LSP_RENAME:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" ln");
-            return false;
-
-        case MC_GIT_STAGE:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" gs");
-            return false;
-
-        case MC_GIT_BLAME:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" gb");
-            return false;
-
-        // Harpoon (uses nvim leader shortcuts)
-        case MC_HARPOON_NEXT:
-            tap_code(KC_ESCAPE);
-            tap_code(KC_DOT);
-            return false;
-
-        case MC_HARPOON_PREV:
-            tap_code(KC_ESCAPE);
-            tap_code(KC_COMM);
-            return false;
-
-        case MC_HARPOON_GOTO_1:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" h1");
-            return false;
-
-        case MC_HARPOON_GOTO_2:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" h2");
-            return false;
-
-        case MC_HARPOON_GOTO_3:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" h3");
-            return false;
-
-        case MC_HARPOON_GOTO_4:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" h4");
-            return false;
-
-        case MC_HARPOON_GOTO_5:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" h5");
-            return false;
-
-        case MC_HARPOON_ADD:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" ha");
-            return false;
-
-        case MC_HARPOON_MENU:
-            tap_code(KC_ESCAPE);
-            SEND_STRING(" hh");
-            return false;
+				// Completion from the last few keys, see features/magic_trigrams.h.
+				// The Repeat key then repeats its last letter.
+				case M_TRIGRAM: {
+					const char* text = magic_trigram_text;
+					const char last = pgm_read_byte(text + strlen_P(text) - 1);
+					magic_send_string_P(text, KC_A + (last - 'a'));
+				} break;
     }
   }
 
+#ifdef AUTOCORRECTION_FLASH_ENABLE
+  // In place of QMK core's Autocorrect, which would run after this returns.
+  // Sentence Case may have set one-shot Shift for this key since it was
+  // decoded.
+  text_event.mods |= get_oneshot_mods();
+  return process_autocorrection_event(&text_event, record);
+#else
   return true;
+#endif  // AUTOCORRECTION_FLASH_ENABLE
 }
 
 void housekeeping_task_user(void) {
+  output_queue_task();
   select_word_task();
   sentence_case_task();
   orbital_mouse_task();
@@ -1141,12 +1244,52 @@ bool rgb_matrix_indicators_user(void) {
 layer_state_t layer_state_set_user(layer_state_t state) {
     // Enable SOCD cleaner only on GAMER layer.
     socd_cleaner_enabled = IS_LAYER_ON_STATE(state, GAMER);
+    if (socd_cleaner_enabled) {
+        layer_handlers |= HANDLER_SOCD_CLEANER;
+    } else {
+        layer_handlers &= ~HANDLER_SOCD_CLEANER;
+    }
     return state;
 }
 
+#ifdef KEY_TRACE_ENABLE
+bool pre_process_record_user(uint16_t keycode, keyrecord_t* record) {
+    // Record matrix events before combos, tap-hold and process_record_user().
+    pre_process_key_trace(record);
+    return true;
+}
+#endif  // KEY_TRACE_ENABLE
+
+#ifdef RAW_ENABLE
+void raw_hid_receive(uint8_t* data, uint8_t length) {
+    bool handled = false;
+#ifdef LATENCY_STATS_ENABLE
+    handled = handled || latency_stats_raw_hid_receive(data, length);
+#endif  // LATENCY_STATS_ENABLE
+#ifdef KEY_TRACE_ENABLE
+    handled = handled || key_trace_raw_hid_receive(data, length);
+#endif  // KEY_TRACE_ENABLE
+#ifdef AUTOCORRECTION_FLASH_ENABLE
+    handled = handled || autocorrection_flash_raw_hid_receive(data, length);
+#endif  // AUTOCORRECTION_FLASH_ENABLE
+    if (handled) {
+        raw_hid_send(data, length);
+    }
+}
+#endif  // RAW_ENABLE
+
+bool process_detected_host_os_user(os_variant_t detected_os) {
+    // Host-specific hotkeys are looked up once here, not on every key event.
+    os_profile_select(detected_os);
+    return true;
+}
+
 void keyboard_post_init_user(void) {
     // RGB mode is persisted in EEPROM automatically.
     // Default mode is set via RGB_MATRIX_DEFAULT_MODE in config.h.
+#ifdef AUTOCORRECTION_FLASH_ENABLE
+    autocorrection_flash_init();
+#endif  // AUTOCORRECTION_FLASH_ENABLE
 }
 
 #ifdef OLED_ENABLE
@@ -4,6 +4,31 @@ SRC += features/sentence_case.c
 SRC += features/socd_cleaner.c
 SRC += features/orbital_mouse.c
 SRC += features/mouse_turbo_click.c
+SRC += features/output_queue.c
+SRC += features/macro_bytecode.c
+SRC += features/magic_trigrams.c
+SRC += features/os_profile.c
+SRC += features/text_event.c
+
+# Per-stage latency stats of process_record_user(), off by default, printed to
+# the console by the LATENCY key or read over raw HID. See
+# features/latency_stats.h.
+LATENCY_STATS_ENABLE ?= no
+ifeq ($(strip $(LATENCY_STATS_ENABLE)), yes)
+    SRC += features/latency_stats.c
+    OPT_DEFS += -DLATENCY_STATS_ENABLE
+    CONSOLE_ENABLE = yes
+    RAW_ENABLE = yes
+endif
+
+# Key event recorder, read over raw HID by tools/key_trace.py. Off by default.
+# See features/key_trace.h.
+KEY_TRACE_ENABLE ?= no
+ifeq ($(strip $(KEY_TRACE_ENABLE)), yes)
+    SRC += features/key_trace.c
+    OPT_DEFS += -DKEY_TRACE_ENABLE
+    RAW_ENABLE = yes
+endif
 
 ENCODER_MAP_ENABLE = yes
 TAP_DANCE_ENABLE = yes
@@ -18,3 +43,18 @@ AUTOCORRECT_ENABLE = yes
 WPM_ENABLE = yes
 OS_DETECTION_ENABLE = yes
 LTO_ENABLE = yes
+
+# Autocorrection dictionaries written to flash over raw HID by
+# tools/autocorrection_flash.py, with features/autocorrection.c in place of QMK
+# core's Autocorrect. Off by default. See features/autocorrection_flash.h.
+AUTOCORRECTION_FLASH_ENABLE ?= no
+ifeq ($(strip $(AUTOCORRECTION_FLASH_ENABLE)), yes)
+    SRC += features/autocorrection.c
+    SRC += features/autocorrection_flash.c
+    OPT_DEFS += -DAUTOCORRECTION_FLASH_ENABLE
+    # Fails the link if the firmware reaches into the region.
+    AUTOCORRECTION_FLASH_LD := $(dir $(lastword $(MAKEFILE_LIST)))features/autocorrection_flash.ld
+    EXTRALDFLAGS += $(AUTOCORRECTION_FLASH_LD)
+    AUTOCORRECT_ENABLE = no
+    RAW_ENABLE = yes
+endif
@@ -0,0 +1,693 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file autocorrection_compiler.cc
+ * @brief Native autocorrection dictionary compiler
+ *
+ * Overview
+ * --------
+ *
+ * A native version of features/make_autocorrection_data.py. It reads the
+ * same dictionary files, prints the same messages and writes a byte for byte
+ * identical autocorrection_data.h, so the two are interchangeable:
+ *
+ *     make -C tools/autocorrection_compiler
+ *     tools/autocorrection_compiler/build/autocorrection_compiler \
+ *         --words /usr/share/dict/words features/autocorrection_dict.txt
+ *
+ * Typos that would falsely trigger on correctly spelled words are found by
+ * running every word of the `--words` list, one per line, through the
+ * dictionary's own Aho-Corasick automaton, the one serialized into the .h
+ * file. That is linear in the size of the word list, where the Python script
+ * compares every typo with every word, and the word list is split among all
+ * cores. Words are lowercased, and characters other than a-z and ' break words
+ * as they do on the keyboard. Without `--words`, the Python script's fallback
+ * list of 21 words is used.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Characters of typos, in the order of TYPO_CHARS in the Python script, which
+// is the order states are numbered in. ':' is the word break.
+constexpr char kTypoChars[] = "':abcdefghijklmnopqrstuvwxyz";
+constexpr int kNumTypoChars = sizeof(kTypoChars) - 1;
+
+// Words checked when no word list is given, as in the Python script.
+const char* const kFallbackWords[] = {
+    "apparent",    "association", "available",     "classification",
+    "effect",      "entertainment", "fantastic",   "information",
+    "integrate",   "international", "language",    "loosest",
+    "manual",      "nothing",     "provides",      "reference",
+    "statehood",   "technology",  "virtually",     "wealthier",
+    "wonderful"};
+
+struct Entry {
+  int line_number;
+  std::string typo;
+  std::string correction;
+};
+
+struct State {
+  int depth = 0;
+  char last = 0;
+  int leaf = -1;  // Index of the entry whose typo ends here, or -1.
+  int children[kNumTypoChars];  // Trie children, or -1.
+  int next[kNumTypoChars] = {};  // Transitions of the automaton.
+  int fail = 0;
+  int byte_offset = 0;
+
+  State() { std::fill(std::begin(children), std::end(children), -1); }
+};
+
+
+// Messages for each line of the dictionary, printed in line order once the
+// typos have been checked against the word list.
+std::map<int, std::vector<std::string>> messages;
+
+void PrintMessages() {
+  for (const auto& line_messages : messages) {
+    for (const std::string& message : line_messages.second) {
+      std::printf("%s\n", message.c_str());
+    }
+  }
+  messages.clear();
+}
+
+[[noreturn]] void Fail(const std::string& message) {
+  PrintMessages();
+  std::printf("%s\n", message.c_str());
+  std::exit(1);
+}
+
+int TypoCharIndex(char c) {
+  for (int i = 0; i < kNumTypoChars; ++i) {
+    if (kTypoChars[i] == c) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Bit of a typo character in the child bitmap, as TYPO_CHAR_BITS: a-z are
+// bits 0-25, the word break is bit 26 and ' is bit 27.
+int TypoCharBit(char c) {
+  return (c == ':') ? 26 : (c == '\'') ? 27 : c - 'a';
+}
+
+std::string Strip(const std::string& s, const char* chars = " \t\r\n\f\v") {
+  const size_t begin = s.find_first_not_of(chars);
+  if (begin == std::string::npos) {
+    return "";
+  }
+  return s.substr(begin, s.find_last_not_of(chars) - begin + 1);
+}
+
+bool StartsWith(const std::string& s, const std::string& prefix) {
+  return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool EndsWith(const std::string& s, const std::string& suffix) {
+  return s.size() >= suffix.size() &&
+         s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+std::string ReadFile(const std::string& file_name) {
+  std::ifstream in(file_name, std::ios::binary);
+  if (!in) {
+    Fail("Error: Cannot read " + file_name);
+  }
+  std::ostringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+
+// Parses the dictionary like parse_file(), except for the check against
+// correctly spelled words, which CheckTypos() does for all typos at once.
+std::vector<Entry> ParseFile(const std::string& file_name) {
+  std::vector<Entry> entries;
+  std::istringstream lines(ReadFile(file_name));
+  std::string line;
+  for (int line_number = 1; std::getline(lines, line); ++line_number) {
+    line = Strip(line);
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    // Parse syntax "typo -> correction", using strip to ignore indenting.
+    const size_t arrow = line.find("->");
+    std::string typo = Strip(line.substr(0, arrow));
+    if (arrow == std::string::npos || typo.empty()) {
+      Fail("Error:" + std::to_string(line_number) + ": Invalid syntax: \"" +
+           line + "\"");
+    }
+    const std::string correction = Strip(line.substr(arrow + 2));
+    for (char& c : typo) {
+      c = (c == ' ') ? ':' : std::tolower(static_cast<unsigned char>(c));
+    }
+
+    const std::string prefix = std::to_string(line_number) + ": ";
+    if (std::any_of(entries.begin(), entries.end(),
+                    [&](const Entry& e) { return e.typo == typo; })) {
+      messages[line_number].push_back("Warning:" + prefix +
+                                      "Ignoring duplicate typo: \"" + typo +
+                                      "\"");
+      continue;
+    }
+
+    // Check that `typo` is valid.
+    for (char c : typo) {
+      if (TypoCharIndex(c) < 0) {
+        Fail("Error:" + prefix + "Typo \"" + typo +
+             "\" has characters other than " + kTypoChars);
+      }
+    }
+    for (const Entry& other : entries) {
+      if (typo.find(other.typo) != std::string::npos ||
+          other.typo.find(typo) != std::string::npos) {
+        Fail("Error:" + prefix +
+             "Typos may not be substrings of one another, otherwise the "
+             "longer typo would never trigger: \"" +
+             typo + "\" vs. \"" + other.typo + "\".");
+      }
+    }
+    if (typo.size() < 5) {
+      messages[line_number].push_back(
+          "Warning:" + prefix +
+          "It is suggested that typos are at least 5 characters long to "
+          "avoid false triggers: \"" +
+          typo + "\"");
+    }
+
+    entries.push_back({line_number, typo, correction});
+  }
+  return entries;
+}
+
+// Gets the backspaces and the string to type to correct a typo.
+std::pair<int, std::string> LeafCorrection(const Entry& entry) {
+  const bool word_boundary_ending = entry.typo.back() == ':';
+  const std::string typo = Strip(entry.typo, ":");
+  const std::string& correction = entry.correction;
+  size_t i = 0;
+  while (i < std::min(typo.size(), correction.size()) &&
+         typo[i] == correction[i]) {
+    ++i;
+  }
+  const int backspaces =
+      static_cast<int>(typo.size()) - static_cast<int>(i) - 1 +
+      word_boundary_ending;
+  if (backspaces < 0 || backspaces > 63) {
+    Fail("Error: \"" + entry.typo + "\" needs " + std::to_string(backspaces) +
+         " backspaces, which must be 0 to 63.");
+  }
+  return {backspaces, correction.substr(i)};
+}
+
+// Makes the Aho-Corasick automaton that matches the typos, as
+// make_automaton(), with states in breadth first order.
+std::vector<State> MakeAutomaton(const std::vector<Entry>& entries) {
+  std::vector<State> trie(1);
+  for (int e = 0; e < static_cast<int>(entries.size()); ++e) {
+    int state = 0;
+    for (char c : entries[e].typo) {
+      const int ci = TypoCharIndex(c);
+      if (trie[state].children[ci] < 0) {
+        State child;
+        child.depth = trie[state].depth + 1;
+        child.last = c;
+        trie[state].children[ci] = static_cast<int>(trie.size());
+        trie.push_back(child);
+      }
+      state = trie[state].children[ci];
+    }
+    trie[state].leaf = e;
+  }
+
+  // Number the states in breadth first order, so that each failure link, to
+  // the state of the longest proper suffix, points to a state done earlier.
+  std::vector<int> order = {0};
+  std::vector<int> index(trie.size());
+  for (size_t head = 0; head < order.size(); ++head) {
+    index[order[head]] = static_cast<int>(head);
+    for (int ci = 0; ci < kNumTypoChars; ++ci) {
+      if (trie[order[head]].children[ci] >= 0) {
+        order.push_back(trie[order[head]].children[ci]);
+      }
+    }
+  }
+  std::vector<State> states;
+  states.reserve(trie.size());
+  for (int old : order) {
+    states.push_back(trie[old]);
+    for (int& child : states.back().children) {
+      child = (child >= 0) ? index[child] : -1;
+    }
+  }
+
+  for (State& state : states) {
+    const State& fail = states[state.fail];
+    for (int ci = 0; ci < kNumTypoChars; ++ci) {
+      const int child = state.children[ci];
+      if (child >= 0) {
+        states[child].fail = state.depth ? fail.next[ci] : 0;
+        state.next[ci] = child;
+      } else {
+        state.next[ci] = state.depth ? fail.next[ci] : 0;
+      }
+    }
+  }
+
+  // Since typos are not substrings of one another, the only typo a state can
+  // end with is its own, so there are no output links.
+  for (const State& state : states) {
+    for (int s = state.fail; states[s].depth; s = states[s].fail) {
+      if (states[s].leaf >= 0) {
+        Fail("Error: Typos may not be substrings of one another.");
+      }
+    }
+  }
+  return states;
+}
+
+// Packs null-terminated strings, storing each suffix of another string as
+// the end of that string, as make_string_pool().
+std::vector<uint8_t> MakeStringPool(std::vector<std::string> strings,
+                                    std::map<std::string, int>* offsets) {
+  // Sorted by their reverse, a string that is a suffix of others is just
+  // before one of them.
+  for (std::string& s : strings) {
+    std::reverse(s.begin(), s.end());
+  }
+  std::sort(strings.begin(), strings.end());
+  strings.erase(std::unique(strings.begin(), strings.end()), strings.end());
+  for (std::string& s : strings) {
+    std::reverse(s.begin(), s.end());
+  }
+
+  std::vector<uint8_t> pool;
+  for (int i = static_cast<int>(strings.size()) - 1; i >= 0; --i) {
+    const std::string& s = strings[i];
+    if (i + 1 < static_cast<int>(strings.size()) &&
+        EndsWith(strings[i + 1], s)) {
+      const std::string& longer = strings[i + 1];
+      (*offsets)[s] = (*offsets)[longer] +
+                      static_cast<int>(longer.size() - s.size());
+    } else {
+      (*offsets)[s] = static_cast<int>(pool.size());
+      pool.insert(pool.end(), s.begin(), s.end());
+      pool.push_back(0);
+    }
+  }
+  return pool;
+}
+
+void EncodeLink(int byte_offset, std::vector<uint8_t>* data) {
+  if (byte_offset < 0 || byte_offset > 0xffff) {
+    Fail("Error: The autocorrection table is too large, a state link exceeds "
+         "64KB limit. Try reducing the autocorrection dict to fewer entries.");
+  }
+  data->push_back(byte_offset & 255);
+  data->push_back(byte_offset >> 8);
+}
+
+// Merges equivalent states of the trie, as minimize_trie(): deepest first, each
+// state's children are replaced by the first state equivalent to each.
+void MinimizeTrie(std::vector<State>& states,
+                  const std::vector<Entry>& entries) {
+  std::vector<int> by_depth(states.size() - 1);
+  for (int s = 1; s < static_cast<int>(states.size()); ++s) {
+    by_depth[s - 1] = s;
+  }
+  std::stable_sort(by_depth.begin(), by_depth.end(), [&](int a, int b) {
+    return states[a].depth > states[b].depth;
+  });
+
+  std::vector<int> merged(states.size());
+  std::map<std::string, int> classes;
+  auto merge_children = [&](State& state) {
+    for (int& child : state.children) {
+      child = (child >= 0) ? merged[child] : -1;
+    }
+  };
+  for (int s : by_depth) {
+    State& state = states[s];
+    std::string key;
+    if (state.leaf >= 0) {
+      const auto correction = LeafCorrection(entries[state.leaf]);
+      key = "leaf" + std::to_string(correction.first) + ":" + correction.second;
+    } else {
+      merge_children(state);
+      key = "node" + std::to_string(states[state.fail].depth);
+      for (int child : state.children) {
+        key += ":" + std::to_string(child);
+      }
+    }
+    merged[s] = classes.emplace(key, s).first->second;
+  }
+  merge_children(states[0]);
+}
+
+// Serializes the automaton as serialize_automaton(): the trie in depth first
+// order, each state once, with its failure depth.
+std::vector<uint8_t> SerializeAutomaton(std::vector<State>& states,
+                                        const std::vector<Entry>& entries) {
+  std::vector<std::string> corrections;
+  for (const State& state : states) {
+    if (state.leaf >= 0) {
+      corrections.push_back(LeafCorrection(entries[state.leaf]).second);
+    }
+  }
+  std::map<std::string, int> pool_offsets;
+  const std::vector<uint8_t> pool = MakeStringPool(corrections, &pool_offsets);
+
+  // Trie children of a state as (bit, state), in bit order.
+  auto children = [&](const State& state) {
+    std::vector<std::pair<int, int>> links;
+    for (int ci = 0; ci < kNumTypoChars; ++ci) {
+      if (state.children[ci] >= 0) {
+        links.push_back({TypoCharBit(kTypoChars[ci]), state.children[ci]});
+      }
+    }
+    std::sort(links.begin(), links.end());
+    return links;
+  };
+
+  std::vector<int> order;
+  std::vector<int> index(states.size(), -1);
+  std::function<void(int)> visit = [&](int s) {
+    index[s] = static_cast<int>(order.size());
+    order.push_back(s);
+    for (const auto& link : children(states[s])) {
+      if (index[link.second] < 0) {
+        visit(link.second);
+      }
+    }
+  };
+  visit(0);
+
+  int pool_start = 0;
+  auto serialize = [&](int s, std::vector<uint8_t>* data) {
+    const State& state = states[s];
+    if (state.leaf >= 0) {  // Handle a leaf state.
+      const auto correction = LeafCorrection(entries[state.leaf]);
+      data->push_back(correction.first + 192);
+      EncodeLink(pool_start + pool_offsets[correction.second], data);
+      return;
+    }
+    const int fail_depth = states[state.fail].depth;
+    data->push_back(std::min(fail_depth, 5) * 32);
+    if (fail_depth >= 5) {
+      data->push_back(fail_depth);
+    }
+    uint8_t& code = (*data)[data->size() - 1 - (fail_depth >= 5)];
+    const auto links = children(state);
+    if (links.size() == 1) {  // Handle a state with one transition.
+      if (index[links[0].second] == index[s] + 1) {
+        code += links[0].first;
+        return;
+      }
+      code += 30;
+      data->push_back(links[0].first);
+      EncodeLink(states[links[0].second].byte_offset, data);
+      return;
+    }
+    // Handle a state with several transitions.
+    uint32_t bitmap = 0;
+    for (const auto& link : links) {
+      bitmap |= UINT32_C(1) << link.first;
+    }
+    code += 31;
+    for (int shift = 0; shift < 32; shift += 8) {
+      data->push_back((bitmap >> shift) & 255);
+    }
+    for (const auto& link : links) {
+      EncodeLink(states[link.second].byte_offset, data);
+    }
+  };
+
+  // To encode links, first compute the byte offset of each state.
+  for (int s : order) {
+    std::vector<uint8_t> bytes;
+    serialize(s, &bytes);
+    states[s].byte_offset = pool_start;
+    pool_start += static_cast<int>(bytes.size());
+  }
+
+  std::vector<uint8_t> data;
+  for (int s : order) {
+    serialize(s, &data);
+  }
+  data.insert(data.end(), pool.begin(), pool.end());
+  return data;
+}
+
+// Reads the word list: lowercased, sorted and without duplicates.
+std::vector<std::string> ReadWords(const char* file_name) {
+  std::vector<std::string> words;
+  if (!file_name) {
+    words.assign(std::begin(kFallbackWords), std::end(kFallbackWords));
+    return words;
+  }
+  std::istringstream lines(ReadFile(file_name));
+  std::string word;
+  while (std::getline(lines, word)) {
+    word = Strip(word);
+    if (!word.empty()) {
+      for (char& c : word) {
+        c = std::tolower(static_cast<unsigned char>(c));
+      }
+      words.push_back(std::move(word));
+    }
+  }
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+  return words;
+}
+
+// Checks the typos against correctly spelled words, as
+// check_typo_against_dictionary(), adding warnings to `messages`.
+void CheckTypos(const std::vector<State>& states,
+                const std::vector<Entry>& entries,
+                const std::vector<std::string>& words) {
+  // Transition on each byte, with characters other than a-z and ' as the word
+  // break.
+  int char_index[256];
+  for (int c = 0; c < 256; ++c) {
+    const int ci = (c == '\'' || ('a' <= c && c <= 'z')) ? TypoCharIndex(c)
+                                                         : TypoCharIndex(':');
+    char_index[c] = ci;
+  }
+
+  // Each thread runs ":word:" for a share of the words through the automaton,
+  // collecting the (entry, word) pairs where the state reaches a typo.
+  const int num_threads = static_cast<int>(
+      std::max(1u, std::min<unsigned>(std::thread::hardware_concurrency(),
+                                      1 + words.size() / 4096)));
+  std::vector<std::vector<std::pair<int, int>>> hits(num_threads);
+  auto scan = [&](int thread) {
+    const size_t begin = words.size() * thread / num_threads;
+    const size_t end = words.size() * (thread + 1) / num_threads;
+    const int word_break = TypoCharIndex(':');
+    for (size_t w = begin; w < end; ++w) {
+      int state = states[0].next[word_break];
+      int last_hit = -1;
+      auto visit = [&](int s) {
+        if (states[s].leaf >= 0 && states[s].leaf != last_hit) {
+          last_hit = states[s].leaf;
+          hits[thread].push_back({last_hit, static_cast<int>(w)});
+        }
+      };
+      for (unsigned char c : words[w]) {
+        state = states[state].next[char_index[c]];
+        visit(state);
+      }
+      visit(states[state].next[word_break]);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int t = 1; t < num_threads; ++t) {
+    threads.emplace_back(scan, t);
+  }
+  scan(0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<std::pair<int, int>> all_hits;
+  for (const auto& thread_hits : hits) {
+    all_hits.insert(all_hits.end(), thread_hits.begin(), thread_hits.end());
+  }
+  std::sort(all_hits.begin(), all_hits.end());
+  all_hits.erase(std::unique(all_hits.begin(), all_hits.end()),
+                 all_hits.end());
+  for (const auto& hit : all_hits) {
+    const Entry& entry = entries[hit.first];
+    const std::string prefix =
+        "Warning:" + std::to_string(entry.line_number) + ": Typo \"" +
+        entry.typo + "\" ";
+    if (entry.typo.front() == ':' && entry.typo.back() == ':') {
+      messages[entry.line_number].push_back(
+          prefix + "is a correctly spelled dictionary word.");
+    } else {
+      messages[entry.line_number].push_back(
+          prefix + "would falsely trigger on correctly spelled word \"" +
+          words[hit.second] + "\".");
+    }
+  }
+}
+
+// Writes autocorrection data as generated C code, as write_generated_code().
+void WriteGeneratedCode(const std::vector<Entry>& entries,
+                        const std::vector<uint8_t>& data,
+                        const std::string& file_name) {
+  const Entry* min_typo = &entries[0];
+  const Entry* max_typo = &entries[0];
+  for (const Entry& e : entries) {
+    if (e.typo.size() < min_typo->typo.size()) {
+      min_typo = &e;
+    }
+    if (e.typo.size() > max_typo->typo.size()) {
+      max_typo = &e;
+    }
+  }
+
+  std::vector<std::string> dictionary;
+  for (const Entry& e : entries) {
+    std::string typo = e.typo;
+    typo.resize(std::max(typo.size(), max_typo->typo.size()), ' ');
+    dictionary.push_back("//   " + typo + " -> " + e.correction + "\n");
+  }
+  std::sort(dictionary.begin(), dictionary.end());
+
+  std::string code = "// Generated code.\n\n// Autocorrection dictionary (" +
+                     std::to_string(entries.size()) + " entries):\n";
+  for (const std::string& line : dictionary) {
+    code += line;
+  }
+  code += "\n#define AUTOCORRECTION_MIN_LENGTH " +
+          std::to_string(min_typo->typo.size()) + "  // \"" + min_typo->typo +
+          "\"\n";
+  code += "#define AUTOCORRECTION_MAX_LENGTH " +
+          std::to_string(max_typo->typo.size()) + "  // \"" + max_typo->typo +
+          "\"\n\n";
+
+  // Fill to 80 columns with an indent of 2 on continuation lines, as Python's
+  // textwrap.fill() does for text of words separated by single spaces.
+  std::vector<std::string> words = {
+      "static", "const", "uint8_t",
+      "autocorrection_data[" + std::to_string(data.size()) + "]", "PROGMEM",
+      "="};
+  for (size_t i = 0; i < data.size(); ++i) {
+    words.push_back((i == 0 ? "{" : "") + std::to_string(data[i]) +
+                    (i + 1 < data.size() ? "," : "};"));
+  }
+  std::string line = words[0];
+  for (size_t i = 1; i < words.size(); ++i) {
+    if (line.size() + 1 + words[i].size() <= 80) {
+      line += " " + words[i];
+    } else {
+      code += line + "\n";
+      line = "  " + words[i];
+    }
+  }
+  code += line + "\n\n";
+
+  std::ofstream out(file_name, std::ios::binary);
+  out << code;
+  if (!out) {
+    Fail("Error: Cannot write " + file_name);
+  }
+}
+
+std::string GetDefaultHFile(const std::string& dict_file) {
+  const size_t slash = dict_file.rfind('/');
+  return (slash == std::string::npos)
+             ? "autocorrection_data.h"
+             : dict_file.substr(0, slash + 1) + "autocorrection_data.h";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* words_file = nullptr;
+  std::vector<std::string> args;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--words" && i + 1 < argc) {
+      words_file = argv[++i];
+    } else if (StartsWith(arg, "--")) {
+      Fail("usage: autocorrection_compiler [--words FILE] [DICT [OUT.h]]");
+    } else {
+      args.push_back(arg);
+    }
+  }
+  const std::string dict_file =
+      (args.size() > 0) ? args[0] : "autocorrection_dict.txt";
+  const std::string h_file =
+      (args.size() > 1) ? args[1] : GetDefaultHFile(dict_file);
+
+  if (!words_file) {
+    std::printf(
+        "Autocorrection will falsely trigger when a typo is a substring of a "
+        "correctly spelled word. To check for this, pass a list of correctly "
+        "spelled words, one per line, with --words FILE.\n\n");
+  }
+
+  const std::vector<Entry> entries = ParseFile(dict_file);
+  if (entries.empty()) {
+    Fail("Error: " + dict_file + " has no autocorrection entries.");
+  }
+  std::vector<State> states = MakeAutomaton(entries);
+  CheckTypos(states, entries, ReadWords(words_file));
+  PrintMessages();
+
+  const size_t unmerged_size = SerializeAutomaton(states, entries).size();
+  MinimizeTrie(states, entries);
+  const std::vector<uint8_t> data = SerializeAutomaton(states, entries);
+  std::printf(
+      "Processed %zu autocorrection entries to table with %zu bytes, from %zu "
+      "bytes before merging states.\n",
+      entries.size(), data.size(), unmerged_size);
+
+  int tail_keys = 0;
+  int word_keys = 0;
+  for (const Entry& e : entries) {
+    const auto correction = LeafCorrection(e);
+    tail_keys += correction.first + static_cast<int>(correction.second.size());
+    word_keys += static_cast<int>(Strip(e.typo, ":").size()) - 1 +
+                 (e.typo.back() == ':') + static_cast<int>(e.correction.size());
+  }
+  std::printf(
+      "Corrections send %.1f keys on average, %.1f to retype the whole word.\n",
+      static_cast<double>(tail_keys) / entries.size(),
+      static_cast<double>(word_keys) / entries.size());
+
+  WriteGeneratedCode(entries, data, h_file);
+  return 0;
+}
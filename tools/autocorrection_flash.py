@@ -0,0 +1,169 @@
+# Copyright 2026 Artur Gomes
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Program to write autocorrection dictionaries to the keyboard's flash."""
+import re
+import sys
+import zlib
+from typing import Iterator, List, Tuple
+
+HELP_TEXT = """Write autocorrection dictionaries to the keyboard's flash.
+Use: python3 autocorrection_flash.py command [FILE]
+
+Commands:
+  write FILE    Writes the dictionary in FILE, an autocorrection_data.h
+                generated by features/make_autocorrection_data.py, to the
+                keyboard, which uses it from then on.
+  packets FILE  Same, but prints the raw HID requests as hex, one per line,
+                e.g. for `sim --raw-hid`.
+  info          Shows the dictionary in use.
+  builtin       Switches back to the dictionary built into the firmware.
+
+Talking to the keyboard needs the hidapi module: pip install hidapi
+"""
+
+RAW_HID_USAGE_PAGE = 0xFF60
+RAW_HID_USAGE = 0x61
+REPORT_SIZE = 32
+AUTOCORRECTION_FLASH_RAW_HID_ID = 0x41
+
+CMD_INFO = 0
+CMD_BEGIN = 1
+CMD_WRITE = 2
+CMD_COMMIT = 3
+CMD_BUILTIN = 4
+
+STATUS_MESSAGES = [
+  'OK',
+  'Request out of order.',
+  'Dictionary too large, or typos too short or long.',
+  'CRC mismatch; the dictionary was not written correctly.',
+]
+
+# Bytes of the dictionary per write request, after the id, command, offset
+# and count.
+BYTES_PER_WRITE = REPORT_SIZE - 5
+
+Dictionary = Tuple[List[int], int, int]  # data, min length, max length.
+
+
+def parse_h_file(file_name: str) -> Dictionary:
+  """Reads the data and typo lengths of a generated autocorrection_data.h."""
+  with open(file_name, 'rt') as f:
+    text = f.read()
+  min_length = re.search(r'AUTOCORRECTION_MIN_LENGTH (\d+)', text)
+  max_length = re.search(r'AUTOCORRECTION_MAX_LENGTH (\d+)', text)
+  array = re.search(r'autocorrection_data\[\d+\] PROGMEM = \{([^}]*)\}', text)
+  if not (min_length and max_length and array):
+    print(f'{file_name} is not generated by make_autocorrection_data.py.')
+    sys.exit(1)
+  data = [int(b) for b in array.group(1).split(',')]
+  return data, int(min_length.group(1)), int(max_length.group(1))
+
+
+def write_requests(dictionary: Dictionary) -> Iterator[List[int]]:
+  """Generates the requests, after the id, that write `dictionary`."""
+  data, min_length, max_length = dictionary
+  size = len(data)
+  crc = zlib.crc32(bytes(data))
+  yield [CMD_BEGIN, size & 0xFF, size >> 8, min_length, max_length,
+         *crc.to_bytes(4, 'little')]
+  for offset in range(0, size, BYTES_PER_WRITE):
+    chunk = data[offset:offset + BYTES_PER_WRITE]
+    yield [CMD_WRITE, offset & 0xFF, offset >> 8, len(chunk), *chunk]
+  yield [CMD_COMMIT]
+
+
+class Keyboard:
+  """Raw HID connection to the keyboard."""
+
+  def __init__(self):
+    try:
+      import hid  # pylint: disable=import-outside-toplevel
+    except ImportError:
+      print('Talking to the keyboard needs hidapi: pip install hidapi')
+      sys.exit(1)
+
+    for info in hid.enumerate():
+      if (info['usage_page'] == RAW_HID_USAGE_PAGE and
+          info['usage'] == RAW_HID_USAGE):
+        self.device = hid.device()
+        self.device.open_path(info['path'])
+        return
+
+    print('No keyboard with raw HID found.')
+    sys.exit(1)
+
+  def request(self, command: int, *args: int) -> List[int]:
+    """Sends an Autocorrection Flash request and returns the reply."""
+    report = [AUTOCORRECTION_FLASH_RAW_HID_ID, command, *args]
+    report += [0] * (REPORT_SIZE - len(report))
+    self.device.write([0] + report)  # Report ID 0 goes first.
+    # Erasing a slot takes a while.
+    reply = self.device.read(REPORT_SIZE, 5000)
+    if len(reply) < 3 or reply[0] != AUTOCORRECTION_FLASH_RAW_HID_ID:
+      print('No reply from Autocorrection Flash. '
+            'Is AUTOCORRECTION_FLASH_ENABLE = yes in rules.mk?')
+      sys.exit(1)
+    return reply
+
+  def write(self, dictionary: Dictionary) -> None:
+    """Writes the dictionary, stopping at the first error."""
+    for command, *args in write_requests(dictionary):
+      status = self.request(command, *args)[2]
+      if status != 0:
+        print(f'Error: {STATUS_MESSAGES[min(status, 3)]}')
+        sys.exit(1)
+
+  def print_info(self) -> None:
+    reply = self.request(CMD_INFO)
+    slot = reply[2]
+    size = reply[3] | reply[4] << 8
+    sequence = int.from_bytes(bytes(reply[5:9]), 'little')
+    max_size = reply[9] | reply[10] << 8
+    if slot:
+      print(f'Dictionary in flash slot {slot}: {size} bytes, '
+            f'written {sequence} times.')
+    else:
+      print('Built-in dictionary.')
+    print(f'Dictionaries up to {max_size} bytes fit.')
+
+
+def main(argv):
+  args = argv[1:]
+  if not args:  # No command given; show help text and exit.
+    print(HELP_TEXT)
+    sys.exit(1)
+
+  command = args[0]
+  if command in ('write', 'packets') and len(args) == 2:
+    dictionary = parse_h_file(args[1])
+    if command == 'packets':
+      for request in write_requests(dictionary):
+        print(' '.join(f'{b:02x}'
+                       for b in [AUTOCORRECTION_FLASH_RAW_HID_ID, *request]))
+    else:
+      Keyboard().write(dictionary)
+      print(f'Wrote {len(dictionary[0])} bytes.')
+  elif command == 'info':
+    Keyboard().print_info()
+  elif command == 'builtin':
+    Keyboard().request(CMD_BUILTIN)
+  else:
+    print(HELP_TEXT)
+    sys.exit(1)
+
+
+if __name__ == '__main__':
+  main(sys.argv)
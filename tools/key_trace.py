@@ -0,0 +1,174 @@
+# Copyright 2026 Artur Gomes
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Program to read Key Trace recordings from the keyboard over raw HID."""
+import sys
+from typing import Iterator, List, Tuple
+
+HELP_TEXT = """Read Key Trace recordings from the keyboard.
+Use: python3 key_trace.py command [options]
+
+Commands:
+  read          Reads the trace from the keyboard and prints it in the
+                format of tools/sim, one "<time_ms> <row> <col> d|u" event
+                per line. Recording is paused while reading.
+  decode FILE   Same, but decodes a raw trace saved to FILE, e.g. by
+                `sim --key-trace FILE`.
+  clear         Clears the trace on the keyboard.
+  pause         Pauses recording.
+  resume        Resumes recording.
+
+Options:
+  --raw=FILE    With read, also saves the raw trace to FILE.
+  --clear       With read, clears the trace after reading it.
+
+Reading from the keyboard needs the hidapi module: pip install hidapi
+"""
+
+RAW_HID_USAGE_PAGE = 0xFF60
+RAW_HID_USAGE = 0x61
+REPORT_SIZE = 32
+KEY_TRACE_RAW_HID_ID = 0x54
+
+CMD_INFO = 0
+CMD_READ = 1
+CMD_CLEAR = 2
+CMD_SET_RECORDING = 3
+
+TraceEvent = Tuple[int, int, int, bool]  # time_ms, row, col, pressed.
+
+
+def decode(data: bytes) -> Iterator[TraceEvent]:
+  """Decodes raw trace bytes into events with absolute times."""
+  time_ms = 0
+  i = 0
+  while i < len(data):
+    key = data[i]
+    i += 1
+    delta = 0
+    shift = 0
+    while i < len(data):
+      byte = data[i]
+      i += 1
+      delta |= (byte & 0x7F) << shift
+      shift += 7
+      if not byte & 0x80:
+        break
+
+    time_ms += delta
+    yield time_ms, (key >> 3) & 0x0F, key & 0x07, bool(key & 0x80)
+
+
+def format_trace(events: Iterator[TraceEvent]) -> str:
+  return ''.join(f'{time_ms} {row} {col} {"d" if pressed else "u"}\n'
+                 for time_ms, row, col, pressed in events)
+
+
+class Keyboard:
+  """Raw HID connection to the keyboard."""
+
+  def __init__(self):
+    try:
+      import hid  # pylint: disable=import-outside-toplevel
+    except ImportError:
+      print('Reading from the keyboard needs hidapi: pip install hidapi')
+      sys.exit(1)
+
+    for info in hid.enumerate():
+      if (info['usage_page'] == RAW_HID_USAGE_PAGE and
+          info['usage'] == RAW_HID_USAGE):
+        self.device = hid.device()
+        self.device.open_path(info['path'])
+        return
+
+    print('No keyboard with raw HID found.')
+    sys.exit(1)
+
+  def request(self, command: int, *args: int) -> List[int]:
+    """Sends a Key Trace request and returns the reply."""
+    report = [KEY_TRACE_RAW_HID_ID, command, *args]
+    report += [0] * (REPORT_SIZE - len(report))
+    self.device.write([0] + report)  # Report ID 0 goes first.
+    reply = self.device.read(REPORT_SIZE, 1000)
+    if len(reply) < 2 or reply[0] != KEY_TRACE_RAW_HID_ID:
+      print('No reply from Key Trace. Is KEY_TRACE_ENABLE = yes in rules.mk?')
+      sys.exit(1)
+    return reply
+
+  def read_trace(self) -> bytes:
+    """Reads the whole trace, pausing recording meanwhile."""
+    was_recording = self.request(CMD_INFO)[2]
+    self.request(CMD_SET_RECORDING, 0)
+    reply = self.request(CMD_INFO)
+    size = reply[3] | reply[4] << 8
+
+    data = bytearray()
+    while len(data) < size:
+      offset = len(data)
+      reply = self.request(CMD_READ, offset & 0xFF, offset >> 8)
+      n = reply[4]
+      if n == 0:
+        break
+      data += bytes(reply[5:5 + n])
+
+    self.request(CMD_SET_RECORDING, was_recording)
+    return bytes(data)
+
+
+def main(argv):
+  raw_file_name = None
+  clear_after_read = False
+  args = []
+
+  for arg in argv[1:]:
+    if arg.startswith('--'):  # Parse command line options.
+      option, _, value = arg.partition('=')
+      if option == '--raw' and value:
+        raw_file_name = value
+      elif option == '--clear':
+        clear_after_read = True
+      else:
+        print(f'Invalid option: {arg}')
+        sys.exit(1)
+    else:
+      args.append(arg)
+
+  if not args:  # No command given; show help text and exit.
+    print(HELP_TEXT)
+    sys.exit(1)
+
+  command = args[0]
+  if command == 'decode' and len(args) == 2:
+    with open(args[1], 'rb') as f:
+      sys.stdout.write(format_trace(decode(f.read())))
+  elif command == 'read':
+    keyboard = Keyboard()
+    data = keyboard.read_trace()
+    if raw_file_name:
+      with open(raw_file_name, 'wb') as f:
+        f.write(data)
+    if clear_after_read:
+      keyboard.request(CMD_CLEAR)
+    sys.stdout.write(format_trace(decode(data)))
+  elif command == 'clear':
+    Keyboard().request(CMD_CLEAR)
+  elif command in ('pause', 'resume'):
+    Keyboard().request(CMD_SET_RECORDING, int(command == 'resume'))
+  else:
+    print(HELP_TEXT)
+    sys.exit(1)
+
+
+if __name__ == '__main__':
+  main(sys.argv)
@@ -0,0 +1,248 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file autocorrect_reference.c
+ * @brief Reference autocorrection implementation.
+ */
+
+#include "autocorrect_reference.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "quantum.h"
+
+#define MAX_TYPO_LENGTH 64
+// Corrections shorter than this are recased, as in features/autocorrection.c.
+#ifndef AUTOCORRECTION_RECASE_SIZE
+#define AUTOCORRECTION_RECASE_SIZE 32
+#endif  // AUTOCORRECTION_RECASE_SIZE
+
+typedef struct {
+  char* typo;
+  char* correction;
+} entry_t;
+
+static entry_t* entries = NULL;
+static uint32_t num_entries = 0;
+// Open addressing hash table of indices into `entries`, -1 for empty slots.
+static int32_t* table = NULL;
+static uint32_t table_mask = 0;
+static uint8_t min_length = MAX_TYPO_LENGTH;
+static uint8_t max_length = 0;
+
+// The last typed keys as typo characters, at most `max_length` of them, and
+// whether each is a capital. An apostrophe is as the key before it in the word.
+static char typed[MAX_TYPO_LENGTH];
+static bool typed_capital[MAX_TYPO_LENGTH];
+static uint8_t typed_len = 0;
+static char recased[AUTOCORRECTION_RECASE_SIZE + 1];
+
+// FNV-1a hash of the `n` characters at `s`.
+static uint32_t hash(const char* s, size_t n) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < n; ++i) {
+    h = (h ^ (uint8_t)s[i]) * 16777619u;
+  }
+  return h;
+}
+
+// Finds the entry for the typo of `n` characters at `s`, or -1.
+static int32_t find(const char* s, size_t n) {
+  for (uint32_t i = hash(s, n) & table_mask;; i = (i + 1) & table_mask) {
+    const int32_t e = table[i];
+    if (e < 0 || (strlen(entries[e].typo) == n &&
+                  memcmp(entries[e].typo, s, n) == 0)) {
+      return e;
+    }
+  }
+}
+
+static char* strip(char* s) {
+  while (isspace((unsigned char)*s)) {
+    ++s;
+  }
+  size_t n = strlen(s);
+  while (n > 0 && isspace((unsigned char)s[n - 1])) {
+    s[--n] = '\0';
+  }
+  return s;
+}
+
+bool autocorrect_reference_load(const char* path) {
+  FILE* in = fopen(path, "r");
+  if (!in) {
+    fprintf(stderr, "sim: cannot read %s\n", path);
+    return false;
+  }
+  char buffer[1024];
+  for (int line_number = 1; fgets(buffer, sizeof(buffer), in); ++line_number) {
+    char* line = strip(buffer);
+    if (!*line || *line == '#') {
+      continue;
+    }
+    char* arrow = strstr(line, "->");
+    if (!arrow) {
+      fprintf(stderr, "sim: %s:%d: invalid syntax\n", path, line_number);
+      fclose(in);
+      return false;
+    }
+    *arrow = '\0';
+    char* typo = strip(line);
+    const size_t n = strlen(typo);
+    if (n < 1 || n > MAX_TYPO_LENGTH) {
+      fprintf(stderr, "sim: %s:%d: typo must be 1 to %d characters\n", path,
+              line_number, MAX_TYPO_LENGTH);
+      fclose(in);
+      return false;
+    }
+    for (char* c = typo; *c; ++c) {
+      *c = (*c == ' ') ? ':' : tolower((unsigned char)*c);
+    }
+    entries = realloc(entries, (num_entries + 1) * sizeof(entry_t));
+    entries[num_entries++] = (entry_t){
+        .typo = strdup(typo), .correction = strdup(strip(arrow + 2))};
+  }
+  fclose(in);
+  if (!num_entries) {
+    fprintf(stderr, "sim: %s has no entries\n", path);
+    return false;
+  }
+
+  uint32_t table_size = 1;
+  while (table_size < 2 * num_entries) {
+    table_size *= 2;
+  }
+  table = malloc(table_size * sizeof(int32_t));
+  table_mask = table_size - 1;
+  memset(table, -1, table_size * sizeof(int32_t));
+  uint32_t distinct = 0;
+  for (uint32_t e = 0; e < num_entries; ++e) {
+    const size_t n = strlen(entries[e].typo);
+    uint32_t i = hash(entries[e].typo, n) & table_mask;
+    while (table[i] >= 0 && strcmp(entries[table[i]].typo, entries[e].typo)) {
+      i = (i + 1) & table_mask;
+    }
+    if (table[i] < 0) {  // As in the generator, the first of duplicates wins.
+      table[i] = e;
+      ++distinct;
+      min_length = (n < min_length) ? n : min_length;
+      max_length = (n > max_length) ? n : max_length;
+    }
+  }
+  num_entries = distinct;
+  autocorrect_reference_reset();
+  return true;
+}
+
+uint32_t autocorrect_reference_size(void) { return num_entries; }
+
+void autocorrect_reference_reset(void) { typed_len = 0; }
+
+bool autocorrect_reference_press(uint16_t keycode, bool shifted,
+                                 uint8_t* backspaces, const char** correction) {
+  char c;
+  if (KC_A <= keycode && keycode <= KC_Z) {
+    c = 'a' + (keycode - KC_A);
+  } else if (keycode == KC_QUOT) {
+    c = shifted ? ':' : '\'';  // " is a word break, ' is not.
+  } else if (keycode == KC_BSPC) {
+    if (typed_len > 0) {
+      --typed_len;
+    }
+    return false;
+  } else if (KC_1 <= keycode && keycode <= KC_SLSH && keycode != KC_ESC) {
+    if (keycode == KC_ENT) {
+      typed_len = 0;
+    }
+    c = ':';
+  } else {
+    typed_len = 0;
+    return false;
+  }
+
+  bool capital = shifted && c != ':';
+  if (c == '\'') {
+    capital = typed_len > 0 && typed[typed_len - 1] != ':' &&
+              typed_capital[typed_len - 1];
+  }
+  if (typed_len == max_length) {
+    --typed_len;
+    memmove(typed, typed + 1, typed_len);
+    memmove(typed_capital, typed_capital + 1, typed_len);
+  }
+  typed_capital[typed_len] = capital;
+  typed[typed_len++] = c;
+
+  for (uint8_t n = min_length; n <= typed_len; ++n) {
+    const int32_t e = find(typed + typed_len - n, n);
+    if (e < 0) {
+      continue;
+    }
+    // The typo as typed, without word breaks at the ends. The host has all of
+    // it but its last key, unless that key is a word break, which goes after
+    // the correction. Only what differs from the correction is retyped.
+    const char* typo = entries[e].typo;
+    const char* end = typo + n;
+    const bool word_break_ending = end[-1] == ':';
+    while (*typo == ':') {
+      ++typo;
+    }
+    while (end > typo && end[-1] == ':') {
+      --end;
+    }
+    const char* str = entries[e].correction;
+    while (typo < end && *typo == *str) {
+      ++typo;
+      ++str;
+    }
+    *backspaces = (end - typo) - 1 + word_break_ending;
+    *correction = str;
+
+    // Capitalize the correction as the word it is in was typed: all caps if
+    // the word is, or with a capital if it is retyped from the first letter
+    // and only that one is a capital.
+    const int last = typed_len - 1 - word_break_ending;
+    int start = last;
+    while (start > 0 && typed[start - 1] != ':') {
+      --start;
+    }
+    int capitals = 0;
+    for (int k = start; k <= last; ++k) {
+      capitals += typed_capital[k];
+    }
+    const bool all_caps = last > start && capitals == last - start + 1;
+    const bool title = last >= start && capitals == 1 &&
+                       typed_capital[start] &&
+                       *backspaces == typed_len - 1 - start;
+    if ((all_caps || title) && strlen(str) < AUTOCORRECTION_RECASE_SIZE) {
+      for (int k = 0; (recased[k] = str[k]); ++k) {
+        if ((all_caps || k == 0) && islower((unsigned char)str[k])) {
+          recased[k] = toupper((unsigned char)str[k]);
+        }
+      }
+      *correction = recased;
+    }
+
+    typed_len = 0;
+    if (c == ':') {
+      typed[typed_len++] = ':';
+    }
+    return true;
+  }
+  return false;
+}
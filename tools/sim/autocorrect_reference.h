@@ -0,0 +1,58 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file autocorrect_reference.h
+ * @brief Reference autocorrection for checking features/autocorrection.c.
+ *
+ * The reference reads the dictionary text, autocorrection_dict.txt, rather
+ * than the generated automaton. It keeps the last typed keys as a string and,
+ * on each key press, looks up every suffix from the shortest to the longest
+ * typo length in a hash map of the typos. It is slow and simple on purpose:
+ * `sim --bench-autocorrect` checks that the automaton fires exactly where this
+ * does, with the same backspaces and correction.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Reads the dictionary at `path`, in the syntax of make_autocorrection_data.py.
+ * Prints the error and returns false if it cannot be read.
+ */
+bool autocorrect_reference_load(const char* path);
+
+/** Number of distinct typos loaded. */
+uint32_t autocorrect_reference_size(void);
+
+/** Forgets the typed keys, as after power on. */
+void autocorrect_reference_reset(void);
+
+/**
+ * Processes the press of a basic keycode, with Shift held if `shifted`, the
+ * way process_autocorrection() does. Returns true if it completes a typo, with
+ * the backspaces to tap and the text to type.
+ */
+bool autocorrect_reference_press(uint16_t keycode, bool shifted,
+                                 uint8_t* backspaces, const char** correction);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,63 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file keycode_cache.c
+ * @brief Keycode Cache implementation.
+ */
+
+#include "keycode_cache.h"
+
+keycode_cache_entry_t keycode_cache[MATRIX_ROWS][MATRIX_COLS];
+
+static layer_state_t cached_layers = 0;
+static bool cache_valid = false;
+
+// Walks down from layer `top` to the first active layer where `key` isn't
+// transparent, falling back to layer 0 like QMK.
+static void resolve(keypos_t key, int8_t top, layer_state_t layers) {
+  keycode_cache_entry_t* entry = &keycode_cache[key.row][key.col];
+  for (int8_t i = top; i >= 0; --i) {
+    if (layers & ((layer_state_t)1 << i)) {
+      const uint16_t keycode = keymap_key_to_keycode(i, key);
+      if (keycode != KC_TRNS) {
+        entry->keycode = keycode;
+        entry->layer = i;
+        return;
+      }
+    }
+  }
+  entry->keycode = keymap_key_to_keycode(0, key);
+  entry->layer = 0;
+}
+
+void keycode_cache_update(layer_state_t layers) {
+  const layer_state_t changed = cache_valid ? (layers ^ cached_layers) : ~(layer_state_t)0;
+  if (!changed) {
+    return;
+  }
+  // Keys whose source layer is above the highest changed layer keep it.
+  const int8_t top = get_highest_layer(changed);
+
+  for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+    for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+      if (!cache_valid || keycode_cache[row][col].layer <= top) {
+        resolve((keypos_t){.row = row, .col = col}, top, layers);
+      }
+    }
+  }
+
+  cached_layers = layers;
+  cache_valid = true;
+}
@@ -0,0 +1,66 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file keycode_cache.h
+ * @brief Keycode Cache, compared with the layer stack walk by `--bench-layers`.
+ *
+ * Finding the keycode a key has on the active layers means walking down the
+ * layer stack past each layer where the key is `KC_TRNS`. On a keymap whose
+ * upper layers are mostly transparent, that is several keymap reads per
+ * lookup. Keycode Cache keeps the effective keycode and its source layer for
+ * every key position, so that a lookup is one array read.
+ *
+ * The cache is rebuilt when the layers change. Only the keys that the change
+ * can affect are walked again: those whose source layer is at or below the
+ * highest layer that turned on or off.
+ *
+ * QMK's core resolves the keycode of each key event with its own walk of the
+ * layer stack, and this keymap makes no lookups by key position, so the
+ * firmware has no use for the cache. It lives here as benchmark code: `sim
+ * --bench-layers` checks it against the walk for every combination of layers
+ * and times both.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  uint16_t keycode;
+  uint8_t layer;
+} keycode_cache_entry_t;
+
+extern keycode_cache_entry_t keycode_cache[MATRIX_ROWS][MATRIX_COLS];
+
+/** Updates the cache for `layers`, the active and default layers. */
+void keycode_cache_update(layer_state_t layers);
+
+/** Gets the keycode of `key` on the active layers, as of the last update. */
+static inline uint16_t keycode_cache_get(keypos_t key) {
+  return keycode_cache[key.row][key.col].keycode;
+}
+
+/** Gets the layer that `key`'s keycode comes from. */
+static inline uint8_t keycode_cache_layer(keypos_t key) {
+  return keycode_cache[key.row][key.col].layer;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,40 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file keymap_introspection.c
+ * @brief Compiles keymap.c and exposes the size of its keymaps array.
+ *
+ * Like QMK's keymap_introspection.c, this includes the keymap source directly
+ * so that sizeof() works on `keymaps` without changing keymap.c.
+ */
+
+#include KEYMAP_C
+
+#include "sim.h"
+
+uint8_t sim_keymap_layer_count(void) {
+  return sizeof(keymaps) / sizeof(keymaps[0]);
+}
+
+void sim_keymap_macro_range(uint16_t* first, uint16_t* last) {
+  *first = MC_COMMENT;
+  *last = MC_PANE_RIGHT;
+}
+
+void sim_keymap_print_latency_stats(void) {
+#ifdef LATENCY_STATS_ENABLE
+  latency_stats_print(latency_stage_names);
+#endif  // LATENCY_STATS_ENABLE
+}
@@ -0,0 +1,40 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Host stub of QMK's os_detection.h. The simulated host OS is chosen with the
+// simulator's --os flag.
+
+#pragma once
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+  OS_UNSURE,
+  OS_LINUX,
+  OS_WINDOWS,
+  OS_MACOS,
+  OS_IOS,
+} os_variant_t;
+
+os_variant_t detected_host_os(void);
+// Called by sim_init() with the host OS, unless OS_UNSURE.
+bool process_detected_host_os_user(os_variant_t detected_os);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,731 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file quantum.h
+ * @brief Host stub of the QMK API used by keymap.c and features/.
+ *
+ * This header stands in for QMK's quantum.h when building the host simulator
+ * in tools/sim. It declares just enough of QMK (keycodes, keyrecord_t, mods,
+ * layers, timers, send_string, repeat key, ...) for keymap.c and every C
+ * file in features/ to compile unmodified on Linux. Keycode values follow
+ * QMK's keycodes.h so that range checks in the features behave the same as
+ * on the keyboard. The implementation lives in sim_core.c.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef OS_DETECTION_ENABLE
+#  include "os_detection.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef TAP_CODE_DELAY
+#define TAP_CODE_DELAY 0
+#endif  // TAP_CODE_DELAY
+#ifndef TAPPING_TERM
+#define TAPPING_TERM 200
+#endif  // TAPPING_TERM
+
+// Sofle matrix: 5 rows per half, 6 columns. The encoder push buttons sit at
+// column 5 of each thumb row.
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 6
+#define NUM_ENCODERS 2
+#define NUM_DIRECTIONS 2
+#define SPLIT_KEYBOARD
+
+// clang-format off
+#define LAYOUT(                                                  \
+    LA1, LA2, LA3, LA4, LA5, LA6,           RA6, RA5, RA4, RA3, RA2, RA1, \
+    LB1, LB2, LB3, LB4, LB5, LB6,           RB6, RB5, RB4, RB3, RB2, RB1, \
+    LC1, LC2, LC3, LC4, LC5, LC6,           RC6, RC5, RC4, RC3, RC2, RC1, \
+    LD1, LD2, LD3, LD4, LD5, LD6, LE6, RE6, RD6, RD5, RD4, RD3, RD2, RD1, \
+              LE1, LE2, LE3, LE4, LE5, RE5, RE4, RE3, RE2, RE1)           \
+  {                                                              \
+    { LA1, LA2, LA3, LA4, LA5, LA6 },                            \
+    { LB1, LB2, LB3, LB4, LB5, LB6 },                            \
+    { LC1, LC2, LC3, LC4, LC5, LC6 },                            \
+    { LD1, LD2, LD3, LD4, LD5, LD6 },                            \
+    { LE1, LE2, LE3, LE4, LE5, LE6 },                            \
+    { RA1, RA2, RA3, RA4, RA5, RA6 },                            \
+    { RB1, RB2, RB3, RB4, RB5, RB6 },                            \
+    { RC1, RC2, RC3, RC4, RC5, RC6 },                            \
+    { RD1, RD2, RD3, RD4, RD5, RD6 },                            \
+    { RE1, RE2, RE3, RE4, RE5, RE6 },                            \
+  }
+// clang-format on
+
+// PROGMEM is a no-op on the host. sim.c sets `sim_pgm_read_hook` to see which
+// bytes of tables like autocorrection_data are read; it is NULL otherwise.
+extern void (*sim_pgm_read_hook)(const void* p);
+static inline uint8_t sim_pgm_read_byte(const void* p) {
+  if (sim_pgm_read_hook) {
+    sim_pgm_read_hook(p);
+  }
+  return *(const uint8_t*)p;
+}
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(p) sim_pgm_read_byte(p)
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define uprintf(...) printf(__VA_ARGS__)
+#define dprintf(...) \
+  do {               \
+  } while (0)
+#define dprintln(s) \
+  do {              \
+  } while (0)
+extern bool debug_enable;
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+
+////////////////////////////////////////////////////////////////////////////////
+// Keycodes.
+////////////////////////////////////////////////////////////////////////////////
+
+// clang-format off
+enum qk_keycode_ranges {
+  QK_BASIC                = 0x0000,
+  QK_BASIC_MAX            = 0x00FF,
+  QK_MODS                 = 0x0100,
+  QK_MODS_MAX             = 0x1FFF,
+  QK_MOD_TAP              = 0x2000,
+  QK_MOD_TAP_MAX          = 0x3FFF,
+  QK_LAYER_TAP            = 0x4000,
+  QK_LAYER_TAP_MAX        = 0x4FFF,
+  QK_LAYER_MOD            = 0x5000,
+  QK_LAYER_MOD_MAX        = 0x51FF,
+  QK_TO                   = 0x5200,
+  QK_TO_MAX               = 0x521F,
+  QK_MOMENTARY            = 0x5220,
+  QK_MOMENTARY_MAX        = 0x523F,
+  QK_DEF_LAYER            = 0x5240,
+  QK_DEF_LAYER_MAX        = 0x525F,
+  QK_TOGGLE_LAYER         = 0x5260,
+  QK_TOGGLE_LAYER_MAX     = 0x527F,
+  QK_ONE_SHOT_LAYER       = 0x5280,
+  QK_ONE_SHOT_LAYER_MAX   = 0x529F,
+  QK_ONE_SHOT_MOD         = 0x52A0,
+  QK_ONE_SHOT_MOD_MAX     = 0x52BF,
+  QK_LAYER_TAP_TOGGLE     = 0x52C0,
+  QK_LAYER_TAP_TOGGLE_MAX = 0x52DF,
+  QK_SWAP_HANDS           = 0x5600,
+  QK_SWAP_HANDS_MAX       = 0x56FF,
+  QK_TAP_DANCE            = 0x5700,
+  QK_TAP_DANCE_MAX        = 0x57FF,
+  QK_MACRO                = 0x7700,
+  QK_MACRO_MAX            = 0x777F,
+  QK_LIGHTING             = 0x7800,
+  QK_LIGHTING_MAX         = 0x78FF,
+  QK_QUANTUM              = 0x7C00,
+  QK_QUANTUM_MAX          = 0x7DFF,
+  QK_KB                   = 0x7E00,
+  QK_KB_MAX               = 0x7E3F,
+  QK_USER                 = 0x7E40,
+  QK_USER_MAX             = 0x7FFF,
+  QK_UNICODE              = 0x8000,
+  QK_UNICODE_MAX          = 0xFFFF,
+};
+
+enum qk_keycodes {
+  KC_NO = 0x00, KC_TRNS = 0x01,
+  KC_A = 0x04, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K,
+  KC_L, KC_M, KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W,
+  KC_X, KC_Y, KC_Z,
+  KC_1 = 0x1E, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0,
+  KC_ENTER = 0x28, KC_ESCAPE, KC_BACKSPACE, KC_TAB, KC_SPACE, KC_MINUS,
+  KC_EQUAL, KC_LEFT_BRACKET, KC_RIGHT_BRACKET, KC_BACKSLASH, KC_NONUS_HASH,
+  KC_SEMICOLON, KC_QUOTE, KC_GRAVE, KC_COMMA, KC_DOT, KC_SLASH, KC_CAPS_LOCK,
+  KC_F1 = 0x3A, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10,
+  KC_F11, KC_F12, KC_PRINT_SCREEN, KC_SCROLL_LOCK, KC_PAUSE, KC_INSERT,
+  KC_HOME, KC_PAGE_UP, KC_DELETE, KC_END, KC_PAGE_DOWN, KC_RIGHT, KC_LEFT,
+  KC_DOWN, KC_UP,
+  KC_AUDIO_MUTE = 0xA8, KC_AUDIO_VOL_UP, KC_AUDIO_VOL_DOWN,
+  KC_MEDIA_NEXT_TRACK, KC_MEDIA_PREV_TRACK, KC_MEDIA_STOP,
+  KC_MEDIA_PLAY_PAUSE,
+  MS_UP = 0xCD, MS_DOWN, MS_LEFT, MS_RGHT, MS_BTN1, MS_BTN2, MS_BTN3, MS_BTN4,
+  MS_BTN5, MS_BTN6, MS_BTN7, MS_BTN8, MS_WHLU, MS_WHLD, MS_WHLL, MS_WHLR,
+  MS_ACL0, MS_ACL1, MS_ACL2,
+  KC_LEFT_CTRL = 0xE0, KC_LEFT_SHIFT, KC_LEFT_ALT, KC_LEFT_GUI, KC_RIGHT_CTRL,
+  KC_RIGHT_SHIFT, KC_RIGHT_ALT, KC_RIGHT_GUI,
+
+  RM_ON = QK_LIGHTING + 0x40, RM_OFF, RM_TOGG, RM_NEXT, RM_PREV, RM_HUEU,
+  RM_HUED, RM_SATU, RM_SATD, RM_VALU, RM_VALD, RM_SPDU, RM_SPDD,
+
+  QK_BOOT = QK_QUANTUM,
+  QK_CAPS_WORD_TOGGLE = QK_QUANTUM + 0x73,
+  QK_REPEAT_KEY = QK_QUANTUM + 0x79,
+  QK_ALT_REPEAT_KEY = QK_QUANTUM + 0x7A,
+  QK_LAYER_LOCK = QK_QUANTUM + 0x7B,
+};
+// clang-format on
+
+#define SAFE_RANGE QK_USER
+
+#define KC_TRANSPARENT KC_TRNS
+#define _______ KC_TRNS
+#define XXXXXXX KC_NO
+#define KC_ENT KC_ENTER
+#define KC_ESC KC_ESCAPE
+#define KC_BSPC KC_BACKSPACE
+#define KC_SPC KC_SPACE
+#define KC_MINS KC_MINUS
+#define KC_EQL KC_EQUAL
+#define KC_LBRC KC_LEFT_BRACKET
+#define KC_RBRC KC_RIGHT_BRACKET
+#define KC_BSLS KC_BACKSLASH
+#define KC_NUHS KC_NONUS_HASH
+#define KC_SCLN KC_SEMICOLON
+#define KC_QUOT KC_QUOTE
+#define KC_GRV KC_GRAVE
+#define KC_COMM KC_COMMA
+#define KC_SLSH KC_SLASH
+#define KC_CAPS KC_CAPS_LOCK
+#define KC_PSCR KC_PRINT_SCREEN
+#define KC_INS KC_INSERT
+#define KC_PGUP KC_PAGE_UP
+#define KC_DEL KC_DELETE
+#define KC_PGDN KC_PAGE_DOWN
+#define KC_RGHT KC_RIGHT
+#define KC_MUTE KC_AUDIO_MUTE
+#define KC_VOLU KC_AUDIO_VOL_UP
+#define KC_VOLD KC_AUDIO_VOL_DOWN
+#define KC_MNXT KC_MEDIA_NEXT_TRACK
+#define KC_MPRV KC_MEDIA_PREV_TRACK
+#define KC_MSTP KC_MEDIA_STOP
+#define KC_MPLY KC_MEDIA_PLAY_PAUSE
+#define KC_LCTL KC_LEFT_CTRL
+#define KC_LSFT KC_LEFT_SHIFT
+#define KC_LALT KC_LEFT_ALT
+#define KC_LGUI KC_LEFT_GUI
+#define KC_RCTL KC_RIGHT_CTRL
+#define KC_RSFT KC_RIGHT_SHIFT
+#define KC_RALT KC_RIGHT_ALT
+#define KC_RGUI KC_RIGHT_GUI
+#define KC_MS_BTN1 MS_BTN1
+
+#define QK_REP QK_REPEAT_KEY
+#define QK_AREP QK_ALT_REPEAT_KEY
+#define QK_LLCK QK_LAYER_LOCK
+#define CW_TOGG QK_CAPS_WORD_TOGGLE
+
+// Modifier bits as used in keycodes (5-bit encoding).
+enum mods_5bit {
+  MOD_LCTL = 0x01,
+  MOD_LSFT = 0x02,
+  MOD_LALT = 0x04,
+  MOD_LGUI = 0x08,
+  MOD_RCTL = 0x11,
+  MOD_RSFT = 0x12,
+  MOD_RALT = 0x14,
+  MOD_RGUI = 0x18,
+};
+
+// Modifier bits as used in HID reports (8-bit encoding).
+enum mods_8bit {
+  MOD_BIT_LCTRL = 0x01,
+  MOD_BIT_LSHIFT = 0x02,
+  MOD_BIT_LALT = 0x04,
+  MOD_BIT_LGUI = 0x08,
+  MOD_BIT_RCTRL = 0x10,
+  MOD_BIT_RSHIFT = 0x20,
+  MOD_BIT_RALT = 0x40,
+  MOD_BIT_RGUI = 0x80,
+};
+#define MOD_BIT(code) (1 << ((code) & 0x07))
+#define MOD_MASK_CTRL (MOD_BIT_LCTRL | MOD_BIT_RCTRL)
+#define MOD_MASK_SHIFT (MOD_BIT_LSHIFT | MOD_BIT_RSHIFT)
+#define MOD_MASK_ALT (MOD_BIT_LALT | MOD_BIT_RALT)
+#define MOD_MASK_GUI (MOD_BIT_LGUI | MOD_BIT_RGUI)
+#define MOD_MASK_CS (MOD_MASK_CTRL | MOD_MASK_SHIFT)
+#define MOD_MASK_CA (MOD_MASK_CTRL | MOD_MASK_ALT)
+#define MOD_MASK_CG (MOD_MASK_CTRL | MOD_MASK_GUI)
+#define MOD_MASK_SA (MOD_MASK_SHIFT | MOD_MASK_ALT)
+#define MOD_MASK_SG (MOD_MASK_SHIFT | MOD_MASK_GUI)
+#define MOD_MASK_AG (MOD_MASK_ALT | MOD_MASK_GUI)
+
+#define QK_LCTL 0x0100
+#define QK_LSFT 0x0200
+#define QK_LALT 0x0400
+#define QK_LGUI 0x0800
+#define QK_RMODS_MIN 0x1000
+#define QK_RCTL 0x1100
+#define QK_RSFT 0x1200
+#define QK_RALT 0x1400
+#define QK_RGUI 0x1800
+
+#define LCTL(kc) (QK_LCTL | (kc))
+#define LSFT(kc) (QK_LSFT | (kc))
+#define LALT(kc) (QK_LALT | (kc))
+#define LGUI(kc) (QK_LGUI | (kc))
+#define RCTL(kc) (QK_RCTL | (kc))
+#define RSFT(kc) (QK_RSFT | (kc))
+#define RALT(kc) (QK_RALT | (kc))
+#define RGUI(kc) (QK_RGUI | (kc))
+#define C(kc) LCTL(kc)
+#define S(kc) LSFT(kc)
+#define A(kc) LALT(kc)
+#define G(kc) LGUI(kc)
+
+#define KC_EXLM S(KC_1)
+#define KC_AT S(KC_2)
+#define KC_HASH S(KC_3)
+#define KC_DLR S(KC_4)
+#define KC_PERC S(KC_5)
+#define KC_CIRC S(KC_6)
+#define KC_AMPR S(KC_7)
+#define KC_ASTR S(KC_8)
+#define KC_LPRN S(KC_9)
+#define KC_RPRN S(KC_0)
+#define KC_UNDS S(KC_MINS)
+#define KC_PLUS S(KC_EQL)
+#define KC_LCBR S(KC_LBRC)
+#define KC_RCBR S(KC_RBRC)
+#define KC_PIPE S(KC_BSLS)
+#define KC_COLN S(KC_SCLN)
+#define KC_DQUO S(KC_QUOT)
+#define KC_TILD S(KC_GRV)
+#define KC_LABK S(KC_COMM)
+#define KC_RABK S(KC_DOT)
+#define KC_QUES S(KC_SLSH)
+
+#define MT(mod, kc) (QK_MOD_TAP | (((mod) & 0x1F) << 8) | ((kc) & 0xFF))
+#define LCTL_T(kc) MT(MOD_LCTL, kc)
+#define LSFT_T(kc) MT(MOD_LSFT, kc)
+#define LALT_T(kc) MT(MOD_LALT, kc)
+#define LGUI_T(kc) MT(MOD_LGUI, kc)
+#define RCTL_T(kc) MT(MOD_RCTL, kc)
+#define RSFT_T(kc) MT(MOD_RSFT, kc)
+#define RALT_T(kc) MT(MOD_RALT, kc)
+#define RGUI_T(kc) MT(MOD_RGUI, kc)
+#define LT(layer, kc) (QK_LAYER_TAP | (((layer) & 0xF) << 8) | ((kc) & 0xFF))
+#define TO(layer) (QK_TO | ((layer) & 0x1F))
+#define MO(layer) (QK_MOMENTARY | ((layer) & 0x1F))
+#define DF(layer) (QK_DEF_LAYER | ((layer) & 0x1F))
+#define TG(layer) (QK_TOGGLE_LAYER | ((layer) & 0x1F))
+#define OSL(layer) (QK_ONE_SHOT_LAYER | ((layer) & 0x1F))
+#define OSM(mod) (QK_ONE_SHOT_MOD | ((mod) & 0x1F))
+#define TT(layer) (QK_LAYER_TAP_TOGGLE | ((layer) & 0x1F))
+#define UC(c) (QK_UNICODE | (c))
+
+#define QK_MODS_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_MOD_TAP_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_LAYER_TAP_GET_LAYER(kc) (((kc) >> 8) & 0xF)
+#define QK_LAYER_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_LAYER_MOD_GET_LAYER(kc) (((kc) >> 5) & 0xF)
+#define QK_LAYER_MOD_GET_MODS(kc) ((kc) & 0x1F)
+#define QK_TO_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_MOMENTARY_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_DEF_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_TOGGLE_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_ONE_SHOT_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_ONE_SHOT_MOD_GET_MODS(kc) ((kc) & 0x1F)
+#define QK_LAYER_TAP_TOGGLE_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_SWAP_HANDS_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+
+#define IS_QK_BASIC(kc) ((kc) <= QK_BASIC_MAX)
+#define IS_QK_MODS(kc) (QK_MODS <= (kc) && (kc) <= QK_MODS_MAX)
+#define IS_QK_MOD_TAP(kc) (QK_MOD_TAP <= (kc) && (kc) <= QK_MOD_TAP_MAX)
+#define IS_QK_LAYER_TAP(kc) (QK_LAYER_TAP <= (kc) && (kc) <= QK_LAYER_TAP_MAX)
+#define IS_QK_ONE_SHOT_MOD(kc) \
+  (QK_ONE_SHOT_MOD <= (kc) && (kc) <= QK_ONE_SHOT_MOD_MAX)
+#define IS_MODIFIER_KEYCODE(kc) (KC_LEFT_CTRL <= (kc) && (kc) <= KC_RIGHT_GUI)
+#define IS_MOUSE_KEYCODE(kc) (MS_UP <= (kc) && (kc) <= MS_ACL2)
+#define IS_SWAP_HANDS_KEYCODE(kc) false
+#define MODIFIER_KEYCODE_RANGE KC_LEFT_CTRL ... KC_RIGHT_GUI
+
+////////////////////////////////////////////////////////////////////////////////
+// Key events and records.
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+  uint8_t col;
+  uint8_t row;
+} keypos_t;
+
+typedef enum {
+  TICK_EVENT = 0,
+  KEY_EVENT = 1,
+  ENCODER_CW_EVENT = 2,
+  ENCODER_CCW_EVENT = 3,
+  COMBO_EVENT = 4,
+} keyevent_type_t;
+
+typedef struct {
+  keypos_t key;
+  uint16_t time;
+  keyevent_type_t type;
+  bool pressed;
+} keyevent_t;
+
+#define IS_KEYEVENT(event) ((event).type == KEY_EVENT)
+
+typedef struct {
+  bool interrupted : 1;
+  bool reserved2 : 1;
+  bool reserved1 : 1;
+  bool reserved0 : 1;
+  uint8_t count : 4;
+} tap_t;
+
+typedef struct {
+  keyevent_t event;
+  tap_t tap;
+  uint16_t keycode;
+} keyrecord_t;
+
+typedef union {
+  uint16_t code;
+} action_t;
+#define ACTION_MODS(mods) (0x0000 | ((mods) & 0x1F) << 8)
+#define ACTION_MODS_TAP_KEY(mods, key) (0x2000 | ((mods) & 0x1F) << 8 | (key))
+
+////////////////////////////////////////////////////////////////////////////////
+// Reports.
+////////////////////////////////////////////////////////////////////////////////
+
+#define KEYBOARD_REPORT_KEYS 6
+
+typedef struct {
+  uint8_t mods;
+  uint8_t reserved;
+  uint8_t keys[KEYBOARD_REPORT_KEYS];
+} report_keyboard_t;
+
+typedef struct {
+  uint8_t buttons;
+  int8_t x;
+  int8_t y;
+  int8_t v;
+  int8_t h;
+} report_mouse_t;
+
+void host_mouse_send(report_mouse_t* report);
+
+// Raw HID, as in QMK's raw_hid.h. Replies are written to the reports.
+#define RAW_EPSIZE 32
+void raw_hid_send(uint8_t* data, uint8_t length);
+void raw_hid_receive(uint8_t* data, uint8_t length);
+
+////////////////////////////////////////////////////////////////////////////////
+// Mods and keys.
+////////////////////////////////////////////////////////////////////////////////
+
+uint8_t get_mods(void);
+void add_mods(uint8_t mods);
+void del_mods(uint8_t mods);
+void set_mods(uint8_t mods);
+void clear_mods(void);
+void register_mods(uint8_t mods);
+void unregister_mods(uint8_t mods);
+uint8_t get_weak_mods(void);
+void add_weak_mods(uint8_t mods);
+void del_weak_mods(uint8_t mods);
+void set_weak_mods(uint8_t mods);
+void clear_weak_mods(void);
+void register_weak_mods(uint8_t mods);
+void unregister_weak_mods(uint8_t mods);
+uint8_t get_oneshot_mods(void);
+void add_oneshot_mods(uint8_t mods);
+void del_oneshot_mods(uint8_t mods);
+void set_oneshot_mods(uint8_t mods);
+void clear_oneshot_mods(void);
+uint8_t get_oneshot_layer(void);
+void reset_oneshot_layer(void);
+static inline uint8_t mod_config(uint8_t mod) { return mod; }
+
+void add_key(uint8_t key);
+void del_key(uint8_t key);
+void clear_keys(void);
+void send_keyboard_report(void);
+
+void register_code(uint8_t code);
+void unregister_code(uint8_t code);
+void register_code16(uint16_t code);
+void unregister_code16(uint16_t code);
+void tap_code(uint8_t code);
+void tap_code_delay(uint8_t code, uint16_t delay);
+void tap_code16(uint16_t code);
+void tap_code16_delay(uint16_t code, uint16_t delay);
+
+uint16_t get_tap_keycode(uint16_t keycode);
+
+void process_action(keyrecord_t* record, action_t action);
+void process_record(keyrecord_t* record);
+uint8_t read_source_layers_cache(keypos_t key);
+
+////////////////////////////////////////////////////////////////////////////////
+// Layers.
+////////////////////////////////////////////////////////////////////////////////
+
+typedef uint32_t layer_state_t;
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+#define IS_LAYER_ON_STATE(state, layer) \
+  (((state) & ((layer_state_t)1 << (layer))) != 0)
+#define IS_LAYER_OFF_STATE(state, layer) (!IS_LAYER_ON_STATE(state, layer))
+#define IS_LAYER_ON(layer) layer_state_is(layer)
+#define IS_LAYER_OFF(layer) (!layer_state_is(layer))
+
+void layer_state_set(layer_state_t state);
+bool layer_state_is(uint8_t layer);
+void layer_on(uint8_t layer);
+void layer_off(uint8_t layer);
+void layer_move(uint8_t layer);
+void layer_invert(uint8_t layer);
+void layer_and(layer_state_t state);
+void layer_or(layer_state_t state);
+void layer_clear(void);
+void default_layer_set(layer_state_t state);
+uint8_t get_highest_layer(layer_state_t state);
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
+
+////////////////////////////////////////////////////////////////////////////////
+// Timers. All times are taken from the simulator's virtual clock.
+////////////////////////////////////////////////////////////////////////////////
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+#define timer_expired(current, future) \
+  ((uint16_t)((current) - (future)) < 0x8000)
+#define timer_expired32(current, future) \
+  ((uint32_t)((current) - (future)) < 0x80000000)
+void wait_ms(uint32_t ms);
+void wait_us(uint32_t us);
+uint32_t timer_read_us(void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Deferred execution.
+////////////////////////////////////////////////////////////////////////////////
+
+typedef uint8_t deferred_token;
+typedef uint32_t (*deferred_exec_callback)(uint32_t trigger_time, void* cb_arg);
+#define INVALID_DEFERRED_TOKEN 0
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback,
+                          void* cb_arg);
+bool cancel_deferred_exec(deferred_token token);
+
+////////////////////////////////////////////////////////////////////////////////
+// Send string.
+////////////////////////////////////////////////////////////////////////////////
+
+#define SS_QMK_PREFIX 1
+#define SS_TAP_CODE 1
+#define SS_DOWN_CODE 2
+#define SS_UP_CODE 3
+#define SS_DELAY_CODE 4
+
+#define SS_STRINGIZE(z) #z
+#define SS_ADD_SLASH_X(y) SS_STRINGIZE(\x##y)
+#define SS_TAP(keycode) "\1\1" SS_ADD_SLASH_X(keycode)
+#define SS_DOWN(keycode) "\1\2" SS_ADD_SLASH_X(keycode)
+#define SS_UP(keycode) "\1\3" SS_ADD_SLASH_X(keycode)
+#define SS_DELAY(msecs) "\1\4" #msecs "|"
+#define SS_LCTL(string) SS_DOWN(X_LCTL) string SS_UP(X_LCTL)
+#define SS_LSFT(string) SS_DOWN(X_LSFT) string SS_UP(X_LSFT)
+#define SS_LALT(string) SS_DOWN(X_LALT) string SS_UP(X_LALT)
+#define SS_LGUI(string) SS_DOWN(X_LGUI) string SS_UP(X_LGUI)
+
+// clang-format off
+#define X_A 04
+#define X_B 05
+#define X_C 06
+#define X_D 07
+#define X_E 08
+#define X_F 09
+#define X_G 0a
+#define X_H 0b
+#define X_I 0c
+#define X_J 0d
+#define X_K 0e
+#define X_L 0f
+#define X_M 10
+#define X_N 11
+#define X_O 12
+#define X_P 13
+#define X_Q 14
+#define X_R 15
+#define X_S 16
+#define X_T 17
+#define X_U 18
+#define X_V 19
+#define X_W 1a
+#define X_X 1b
+#define X_Y 1c
+#define X_Z 1d
+#define X_1 1e
+#define X_2 1f
+#define X_3 20
+#define X_4 21
+#define X_5 22
+#define X_6 23
+#define X_7 24
+#define X_8 25
+#define X_9 26
+#define X_0 27
+#define X_ENTER 28
+#define X_ENT 28
+#define X_ESCAPE 29
+#define X_ESC 29
+#define X_BSPC 2a
+#define X_TAB 2b
+#define X_SPC 2c
+#define X_MINS 2d
+#define X_EQL 2e
+#define X_LBRC 2f
+#define X_RBRC 30
+#define X_BSLS 31
+#define X_SCLN 33
+#define X_QUOT 34
+#define X_GRV 35
+#define X_COMM 36
+#define X_DOT 37
+#define X_SLSH 38
+#define X_HOME 4a
+#define X_PGUP 4b
+#define X_DEL 4c
+#define X_END 4d
+#define X_PGDN 4e
+#define X_RGHT 4f
+#define X_LEFT 50
+#define X_DOWN 51
+#define X_UP 52
+#define X_LCTL e0
+#define X_LSFT e1
+#define X_LALT e2
+#define X_LGUI e3
+// clang-format on
+
+#define SEND_STRING(string) send_string_P(PSTR(string))
+#define SEND_STRING_DELAY(string, interval) \
+  send_string_with_delay_P(PSTR(string), interval)
+
+#define PGM_LOADBIT(mem, pos) \
+  ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
+extern const uint8_t ascii_to_shift_lut[16];
+extern const uint8_t ascii_to_altgr_lut[16];
+extern const uint8_t ascii_to_keycode_lut[128];
+
+void send_char(char ascii_code);
+void send_string(const char* string);
+void send_string_P(const char* string);
+void send_string_with_delay(const char* string, uint8_t interval);
+void send_string_with_delay_P(const char* string, uint8_t interval);
+void send_unicode_string(const char* string);
+
+// Unicode input modes, from QMK's unicode.h.
+enum unicode_input_modes {
+  UNICODE_MODE_MACOS,
+  UNICODE_MODE_LINUX,
+  UNICODE_MODE_WINDOWS,
+  UNICODE_MODE_BSD,
+  UNICODE_MODE_WINCOMPOSE,
+  UNICODE_MODE_EMACS,
+};
+void set_unicode_input_mode(uint8_t mode);
+uint8_t get_unicode_input_mode(void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Feature APIs implemented by QMK core.
+////////////////////////////////////////////////////////////////////////////////
+
+// Repeat Key.
+int8_t get_repeat_key_count(void);
+uint16_t get_last_keycode(void);
+uint8_t get_last_mods(void);
+void set_last_keycode(uint16_t keycode);
+void set_last_mods(uint8_t mods);
+uint16_t get_alt_repeat_key_keycode(void);
+uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods);
+bool remember_last_key_user(uint16_t keycode, keyrecord_t* record,
+                            uint8_t* remembered_mods);
+
+// Tap-hold callbacks.
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t* record);
+uint16_t get_quick_tap_term(uint16_t keycode, keyrecord_t* record);
+uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t* record,
+                           uint16_t prev_keycode);
+bool get_speculative_hold(uint16_t keycode, keyrecord_t* record);
+bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t* tap_hold_record,
+                      uint16_t other_keycode, keyrecord_t* other_record);
+bool get_chordal_hold_default(keyrecord_t* tap_hold_record,
+                              keyrecord_t* other_record);
+char chordal_hold_handedness(keypos_t key);
+
+// Keymap hooks.
+bool pre_process_record_user(uint16_t keycode, keyrecord_t* record);
+bool process_record_user(uint16_t keycode, keyrecord_t* record);
+void housekeeping_task_user(void);
+void keyboard_post_init_user(void);
+layer_state_t layer_state_set_user(layer_state_t state);
+layer_state_t default_layer_state_set_user(layer_state_t state);
+bool rgb_matrix_indicators_user(void);
+bool apply_autocorrect(uint8_t backspaces, const char* str, char* typo,
+                       char* correct);
+
+// Caps Word, Layer Lock and Autocorrect come from features/ in the simulator;
+// their handlers are declared here as QMK core declares its own versions.
+bool is_caps_word_on(void);
+void caps_word_toggle(void);
+bool process_caps_word(uint16_t keycode, keyrecord_t* record);
+bool is_layer_locked(uint8_t layer);
+bool process_layer_lock(uint16_t keycode, keyrecord_t* record,
+                        uint16_t lock_keycode);
+bool process_autocorrection(uint16_t keycode, keyrecord_t* record);
+
+// Combos and Tap Dance are declared so keymap.c compiles; the simulator does
+// not process them.
+#define COMBO_END 0
+typedef struct {
+  const uint16_t* keys;
+  uint16_t keycode;
+} combo_t;
+#define COMBO(ck, ca) {.keys = &(ck)[0], .keycode = (ca)}
+typedef struct {
+  void* fn;
+} tap_dance_action_t;
+
+// Encoder map.
+#define ENCODER_CCW_CW(ccw, cw) {(cw), (ccw)}
+
+// RGB Matrix.
+#define RGB_RED 0xFF, 0x00, 0x00
+#define RGB_GREEN 0x00, 0xFF, 0x00
+#define RGB_BLUE 0x00, 0x00, 0xFF
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+
+#ifdef __cplusplus
+}
+#endif
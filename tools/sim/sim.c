@@ -0,0 +1,1011 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file sim.c
+ * @brief Host-side keymap simulator: replays key traces through keymap.c.
+ *
+ * Usage:
+ *
+ *     sim [options] TRACE
+ *     sim [options] --text FILE
+ *
+ * A trace is a text file with one physical key event per line,
+ *
+ *     <time_ms> <row> <col> d|u
+ *
+ * where `d` is a press and `u` a release. Blank lines and lines starting with
+ * `#` are ignored. Alternatively, `--text` converts plain text into a trace by
+ * finding each character on the keymap, as if typed at `--wpm` words per
+ * minute. See README.md for the options.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#endif
+
+#include "autocorrect_reference.h"
+#include "keycode_cache.h"
+#include "sim.h"
+
+typedef struct {
+  uint32_t time;
+  uint8_t row;
+  uint8_t col;
+  bool pressed;
+} trace_event_t;
+
+typedef struct {
+  trace_event_t* events;
+  size_t size;
+  size_t capacity;
+} trace_t;
+
+static void trace_push(trace_t* trace, uint32_t time, uint8_t row, uint8_t col,
+                       bool pressed) {
+  if (trace->size == trace->capacity) {
+    trace->capacity = trace->capacity ? 2 * trace->capacity : 256;
+    trace->events =
+        realloc(trace->events, trace->capacity * sizeof(trace_event_t));
+  }
+  trace->events[trace->size++] =
+      (trace_event_t){.time = time, .row = row, .col = col, .pressed = pressed};
+}
+
+static bool read_trace(FILE* in, trace_t* trace) {
+  char line[256];
+  int line_number = 0;
+  while (fgets(line, sizeof(line), in)) {
+    ++line_number;
+    unsigned time, row, col;
+    char action;
+    const char* p = line + strspn(line, " \t");
+    if (*p == '#' || *p == '\n' || *p == '\0') {
+      continue;
+    }
+    if (sscanf(p, "%u %u %u %c", &time, &row, &col, &action) != 4 ||
+        row >= MATRIX_ROWS || col >= MATRIX_COLS ||
+        (action != 'd' && action != 'u')) {
+      fprintf(stderr, "sim: trace line %d: expected \"<ms> <row> <col> d|u\"\n",
+              line_number);
+      return false;
+    }
+    trace_push(trace, time, row, col, action == 'd');
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Text to trace conversion.
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+  bool found;
+  uint8_t row;
+  uint8_t col;
+  bool shift;       // Whether Shift must be held.
+  bool has_layer;   // Whether the layer key at (layer_row, layer_col) is held.
+  uint8_t layer_row;
+  uint8_t layer_col;
+} key_location_t;
+
+static uint16_t tap_keycode(uint16_t keycode) {
+  if (IS_QK_MOD_TAP(keycode)) {
+    return QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+  } else if (IS_QK_LAYER_TAP(keycode)) {
+    return QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+  }
+  return keycode;
+}
+
+static bool find_on_layer(uint8_t layer, uint16_t keycode, uint8_t* row,
+                          uint8_t* col) {
+  for (uint8_t r = 0; r < MATRIX_ROWS; ++r) {
+    for (uint8_t c = 0; c < MATRIX_COLS; ++c) {
+      const uint16_t kc = keymap_key_to_keycode(layer, (keypos_t){c, r});
+      if (kc == keycode || (layer == 0 && tap_keycode(kc) == keycode &&
+                            !IS_QK_MOD_TAP(keycode))) {
+        *row = r;
+        *col = c;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Finds the base layer key that momentarily activates `layer`.
+static bool find_layer_key(uint8_t layer, uint8_t* row, uint8_t* col) {
+  for (uint8_t r = 0; r < MATRIX_ROWS; ++r) {
+    for (uint8_t c = 0; c < MATRIX_COLS; ++c) {
+      const uint16_t kc = keymap_key_to_keycode(0, (keypos_t){c, r});
+      if ((IS_QK_LAYER_TAP(kc) && QK_LAYER_TAP_GET_LAYER(kc) == layer) ||
+          (QK_MOMENTARY <= kc && kc <= QK_MOMENTARY_MAX &&
+           QK_MOMENTARY_GET_LAYER(kc) == layer)) {
+        *row = r;
+        *col = c;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+static key_location_t locate(uint16_t keycode, bool shift) {
+  key_location_t loc = {0};
+  const uint8_t num_layers = sim_keymap_layer_count();
+  for (uint8_t layer = 0; layer < num_layers; ++layer) {
+    if (layer > 0 && !find_layer_key(layer, &loc.layer_row, &loc.layer_col)) {
+      continue;
+    }
+    // Look for a key that types the character by itself, e.g. KC_EXLM,
+    // before falling back to the unshifted key with Shift held.
+    const uint16_t shifted = shift ? S(keycode) : keycode;
+    if (find_on_layer(layer, shifted, &loc.row, &loc.col)) {
+      loc.found = true;
+    } else if (shift && find_on_layer(layer, keycode, &loc.row, &loc.col)) {
+      loc.found = true;
+      loc.shift = true;
+    }
+    if (loc.found) {
+      loc.has_layer = layer > 0;
+      return loc;
+    }
+  }
+  return loc;
+}
+
+// Maps an ASCII character to a basic keycode on a US layout.
+static uint16_t char_to_keycode(char c, bool* shift) {
+  static const char unshifted[] = "1234567890\n\x1b\b\t -=[]\\#;'`,./";
+  static const char shifted[] = "!@#$%^&*()\n\x1b\b\t _+{}|~:\"~<>?";
+  *shift = false;
+  if ('a' <= c && c <= 'z') {
+    return KC_A + (c - 'a');
+  } else if ('A' <= c && c <= 'Z') {
+    *shift = true;
+    return KC_A + (c - 'A');
+  }
+  for (int i = 0; unshifted[i]; ++i) {
+    if (KC_1 + i == KC_NONUS_HASH) {
+      continue;
+    }
+    if (unshifted[i] == c) {
+      return KC_1 + i;
+    } else if (shifted[i] == c) {
+      *shift = true;
+      return KC_1 + i;
+    }
+  }
+  return KC_NO;
+}
+
+static bool text_to_trace(FILE* in, int wpm, trace_t* trace) {
+  // One "word" is five characters; presses are spaced evenly and each key is
+  // held for half the interval.
+  const uint32_t interval = 12000 / (wpm > 0 ? wpm : 1);
+  const uint32_t hold = interval / 2 > 0 ? interval / 2 : 1;
+  uint8_t shift_row, shift_col;
+  if (!find_on_layer(0, KC_RSFT, &shift_row, &shift_col) &&
+      !find_on_layer(0, KC_LSFT, &shift_row, &shift_col)) {
+    fprintf(stderr, "sim: no Shift key on the base layer\n");
+    return false;
+  }
+
+  uint32_t t = 100;
+  int c;
+  while ((c = fgetc(in)) != EOF) {
+    bool shift;
+    const uint16_t keycode = char_to_keycode((char)c, &shift);
+    const key_location_t loc = keycode ? locate(keycode, shift)
+                                       : (key_location_t){0};
+    if (!loc.found) {
+      fprintf(stderr, "sim: skipping untypeable character 0x%02x\n",
+              (uint8_t)c);
+      continue;
+    }
+    // Modifier and layer keys go down a few ms before the key, and are
+    // released after it.
+    uint32_t start = t;
+    if (loc.has_layer) {
+      trace_push(trace, start, loc.layer_row, loc.layer_col, true);
+      start += 5;
+    }
+    if (loc.shift) {
+      trace_push(trace, start, shift_row, shift_col, true);
+      start += 5;
+    }
+    trace_push(trace, start, loc.row, loc.col, true);
+    trace_push(trace, start + hold, loc.row, loc.col, false);
+    uint32_t end = start + hold;
+    if (loc.shift) {
+      trace_push(trace, ++end, shift_row, shift_col, false);
+    }
+    if (loc.has_layer) {
+      trace_push(trace, ++end, loc.layer_row, loc.layer_col, false);
+    }
+    t = (end - t + 1 > interval) ? end + 1 : t + interval;
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Handler timing.
+//
+// Features called from keymap.c's process_record_user() are timed by linking
+// with `-Wl,--wrap=<handler>`, which redirects keymap.c's calls to the
+// __wrap_ functions below.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "features/autocorrection.h"
+#include "features/custom_shift_keys.h"
+#include "features/key_trace.h"
+#include "features/mouse_turbo_click.h"
+#include "features/orbital_mouse.h"
+#include "features/output_queue.h"
+#include "features/select_word.h"
+#include "features/sentence_case.h"
+#include "features/socd_cleaner.h"
+#include "features/text_event.h"
+
+void __real_text_event_normalize(text_event_t*, uint16_t, keyrecord_t*);
+bool __real_process_socd_cleaner(uint16_t, keyrecord_t*, socd_cleaner_t*);
+bool __real_process_orbital_mouse(uint16_t, keyrecord_t*);
+bool __real_process_sentence_case_event(const text_event_t*, keyrecord_t*);
+bool __real_process_select_word_event(const text_event_t*, uint16_t,
+                                      keyrecord_t*);
+bool __real_process_custom_shift_keys(uint16_t, keyrecord_t*);
+bool __real_process_mouse_turbo_click(uint16_t, keyrecord_t*, uint16_t);
+
+// Whether text_event_normalize() calls are timed. The benchmarks turn it off,
+// as the features' process_*(keycode, record) functions call it too.
+static bool time_text_events = true;
+
+void __wrap_text_event_normalize(text_event_t* event, uint16_t keycode,
+                                 keyrecord_t* record) {
+  if (!time_text_events) {
+    __real_text_event_normalize(event, keycode, record);
+    return;
+  }
+  SIM_TIMED_VOID(SIM_STAT_TEXT_EVENT,
+                 __real_text_event_normalize(event, keycode, record));
+}
+
+bool __wrap_process_socd_cleaner(uint16_t keycode, keyrecord_t* record,
+                                 socd_cleaner_t* state) {
+  return SIM_TIMED(SIM_STAT_SOCD_CLEANER,
+                   __real_process_socd_cleaner(keycode, record, state));
+}
+
+bool __wrap_process_orbital_mouse(uint16_t keycode, keyrecord_t* record) {
+  return SIM_TIMED(SIM_STAT_ORBITAL_MOUSE,
+                   __real_process_orbital_mouse(keycode, record));
+}
+
+bool __wrap_process_sentence_case_event(const text_event_t* event,
+                                        keyrecord_t* record) {
+  return SIM_TIMED(SIM_STAT_SENTENCE_CASE,
+                   __real_process_sentence_case_event(event, record));
+}
+
+bool __wrap_process_select_word_event(const text_event_t* event,
+                                      uint16_t keycode, keyrecord_t* record) {
+  return SIM_TIMED(SIM_STAT_SELECT_WORD,
+                   __real_process_select_word_event(event, keycode, record));
+}
+
+bool __wrap_process_custom_shift_keys(uint16_t keycode, keyrecord_t* record) {
+  return SIM_TIMED(SIM_STAT_CUSTOM_SHIFT_KEYS,
+                   __real_process_custom_shift_keys(keycode, record));
+}
+
+bool __wrap_process_mouse_turbo_click(uint16_t keycode, keyrecord_t* record,
+                                      uint16_t turbo_click_keycode) {
+  return SIM_TIMED(
+      SIM_STAT_MOUSE_TURBO_CLICK,
+      __real_process_mouse_turbo_click(keycode, record, turbo_click_keycode));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Autocorrection.
+//
+// Counts the keys each correction sends and its latency, the time from the key
+// press that completed the typo until the output queue sent the last key.
+////////////////////////////////////////////////////////////////////////////////
+
+static struct {
+  uint32_t corrections;
+  uint32_t keys;
+  uint32_t latency_ms;
+  uint32_t max_latency_ms;
+  uint32_t start_ms;
+  bool pending;
+  // The last correction, for checking against the reference.
+  uint8_t last_backspaces;
+  const char* last_str;
+} autocorrect_stats;
+
+bool __real_apply_autocorrect(uint8_t, const char*, char*, char*);
+void __real_housekeeping_task_user(void);
+
+bool __wrap_apply_autocorrect(uint8_t backspaces, const char* str, char* typo,
+                              char* correct) {
+  ++autocorrect_stats.corrections;
+  autocorrect_stats.keys += backspaces + strlen(str);
+  autocorrect_stats.start_ms = sim_now();
+  autocorrect_stats.pending = true;
+  autocorrect_stats.last_backspaces = backspaces;
+  autocorrect_stats.last_str = str;
+  // Sending the correction is not part of the lookup.
+  void (*hook)(const void*) = sim_pgm_read_hook;
+  sim_pgm_read_hook = NULL;
+  const bool result = __real_apply_autocorrect(backspaces, str, typo, correct);
+  sim_pgm_read_hook = hook;
+  return result;
+}
+
+void __wrap_housekeeping_task_user(void) {
+  __real_housekeeping_task_user();
+  if (autocorrect_stats.pending && output_queue_get_stats().depth == 0) {
+    const uint32_t latency_ms = sim_now() - autocorrect_stats.start_ms;
+    autocorrect_stats.latency_ms += latency_ms;
+    if (latency_ms > autocorrect_stats.max_latency_ms) {
+      autocorrect_stats.max_latency_ms = latency_ms;
+    }
+    autocorrect_stats.pending = false;
+  }
+}
+
+#ifdef LATENCY_STATS_ENABLE
+// Latency Stats reads the host clock, in ns since microseconds are too coarse
+// here. The Makefile sets LATENCY_STATS_UNIT to match.
+uint32_t latency_stats_timer(void) { return (uint32_t)sim_clock_ns(); }
+#endif  // LATENCY_STATS_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////
+// Main.
+////////////////////////////////////////////////////////////////////////////////
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: sim [options] TRACE\n"
+          "       sim [options] --text FILE\n"
+          "options:\n"
+          "  --text FILE       convert plain text to a trace and replay it\n"
+          "  --wpm N           typing speed for --text (default 60)\n"
+          "  --os NAME         detected host OS: linux, windows, macos\n"
+          "  --repeat N        replay the trace N times (default 1)\n"
+          "  --reports FILE    write HID reports to FILE (- for stdout)\n"
+          "  --write-trace F   write the replayed trace to F\n"
+          "  --typed           print the text the host received\n"
+          "  --bench-macros N  time N rounds of dispatching every macro keycode\n"
+          "  --bench-layers N  time N rounds of looking up every key's keycode\n"
+          "  --bench-autocorrect N\n"
+          "                    time N rounds of autocorrecting the --text FILE\n"
+          "  --bench-text-events N\n"
+          "                    time N rounds of the text features on the --text\n"
+          "                    FILE, decoding each event once or per feature\n"
+          "  --autocorrect-dict F\n"
+          "                    with --bench-autocorrect, check every correction\n"
+          "                    against the dictionary text in F\n"
+#ifdef KEY_TRACE_ENABLE
+          "  --key-trace F     write the Key Trace recording to F\n"
+#endif  // KEY_TRACE_ENABLE
+#ifdef RAW_ENABLE
+          "  --raw-hid F       first send the raw HID requests in F, one per\n"
+          "                    line as hex bytes\n"
+#endif  // RAW_ENABLE
+          );
+}
+
+static void print_summary(double wall_s, uint64_t timer_overhead_ns) {
+  const uint64_t events = sim_counters.key_events;
+  printf("key events:        %llu\n", (unsigned long long)events);
+  printf("keyboard reports:  %llu\n",
+         (unsigned long long)sim_counters.keyboard_reports);
+  printf("mouse reports:     %llu\n",
+         (unsigned long long)sim_counters.mouse_reports);
+  printf("virtual time:      %u ms\n", sim_now());
+  printf("blocked in wait:   %llu ms (longest stall %u ms)\n",
+         (unsigned long long)sim_counters.blocked_ms,
+         sim_counters.longest_stall_ms);
+  printf("wall time:         %.3f s (%.0f events/s)\n", wall_s,
+         wall_s > 0 ? events / wall_s : 0.0);
+  const output_queue_stats_t queue = output_queue_get_stats();
+  printf("output queue:      max depth %u, %u flushes (longest %u ms)\n",
+         queue.max_depth, queue.flushes, queue.longest_stall_ms);
+  const double corrections = autocorrect_stats.corrections;
+  printf("autocorrections:   %u, %.1f keys and %.1f ms each (longest %u ms)\n",
+         autocorrect_stats.corrections,
+         corrections ? autocorrect_stats.keys / corrections : 0.0,
+         corrections ? autocorrect_stats.latency_ms / corrections : 0.0,
+         autocorrect_stats.max_latency_ms);
+  printf("timer overhead:    ~%llu ns per timed call (not subtracted)\n\n",
+         (unsigned long long)timer_overhead_ns);
+  printf("%-32s %12s %12s %12s\n", "handler", "calls", "ns/call",
+         "ns/event");
+  for (int i = 0; i < NUM_SIM_STATS; ++i) {
+    const sim_stat_t* stat = &sim_stats[i];
+    if (!stat->calls) {
+      continue;
+    }
+    printf("%-32s %12llu %12.1f %12.1f\n", stat->name,
+           (unsigned long long)stat->calls, (double)stat->ns / stat->calls,
+           events ? (double)stat->ns / events : 0.0);
+  }
+}
+
+// Times process_record_user() dispatching each of keymap.c's macro keycodes.
+// Only the press handler is timed; the queued output is sent between calls.
+static void bench_macros(int rounds) {
+  uint16_t first, last;
+  sim_keymap_macro_range(&first, &last);
+  keyrecord_t record = {.event = {.type = KEY_EVENT}};
+  uint64_t ns = 0;
+  uint64_t calls = 0;
+
+  for (int r = 0; r < rounds; ++r) {
+    for (uint16_t keycode = first; keycode <= last; ++keycode) {
+      record.keycode = keycode;
+      record.event.time = timer_read();
+      record.event.pressed = true;
+      const uint64_t start_ns = sim_clock_ns();
+      process_record_user(keycode, &record);
+      ns += sim_clock_ns() - start_ns;
+      ++calls;
+
+      record.event.pressed = false;
+      process_record_user(keycode, &record);
+      output_queue_flush();
+    }
+  }
+
+  printf("macro keycodes:    %u (0x%04x to 0x%04x)\n", last - first + 1, first,
+         last);
+  printf("macro dispatch:    %.1f ns per press over %llu presses\n",
+         calls ? (double)ns / calls : 0.0, (unsigned long long)calls);
+}
+
+// Checks Keycode Cache against the layer stack walk for every combination of
+// layers, then times both looking up every key with all layers on.
+static void bench_layers(int rounds) {
+  const uint8_t num_layers = sim_keymap_layer_count();
+  const layer_state_t all_layers = ((layer_state_t)1 << num_layers) - 1;
+  uint32_t mismatches = 0;
+
+  // Visit the combinations in Gray code order, so that each step turns one
+  // layer on or off, like a layer key does.
+  for (layer_state_t i = 0; i <= all_layers; ++i) {
+    layer_state_set(i ^ (i >> 1));
+    keycode_cache_update(layer_state | default_layer_state);
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+      for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+        const keypos_t key = {.col = col, .row = row};
+        mismatches += keycode_cache_get(key) != sim_resolve_keycode(row, col);
+      }
+    }
+  }
+
+  layer_state_set(all_layers);
+  keycode_cache_update(layer_state | default_layer_state);
+  volatile uint16_t sink = 0;
+  uint64_t start_ns = sim_clock_ns();
+  for (int r = 0; r < rounds; ++r) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+      for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+        sink = sim_resolve_keycode(row, col);
+      }
+    }
+  }
+  const uint64_t walk_ns = sim_clock_ns() - start_ns;
+
+  start_ns = sim_clock_ns();
+  for (int r = 0; r < rounds; ++r) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+      for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+        sink = keycode_cache_get((keypos_t){.col = col, .row = row});
+      }
+    }
+  }
+  const uint64_t cache_ns = sim_clock_ns() - start_ns;
+  (void)sink;
+
+  const double lookups = (double)rounds * MATRIX_ROWS * MATRIX_COLS;
+  printf("layer states:      %u checked, %u mismatches\n", all_layers + 1,
+         mismatches);
+  printf("layer stack walk:  %.1f ns per lookup, %u layers on\n",
+         lookups ? walk_ns / lookups : 0.0, num_layers);
+  printf("keycode cache:     %.1f ns per lookup\n",
+         lookups ? cache_ns / lookups : 0.0);
+}
+
+// Reads the CPU's cycle counter, or 0 where there is none.
+static uint64_t read_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// Open addressing hash set of addresses, for counting distinct bytes read.
+typedef struct {
+  uintptr_t* slots;
+  size_t mask;
+  size_t size;
+} address_set_t;
+
+static void address_set_insert(address_set_t* set, uintptr_t address) {
+  if (2 * (set->size + 1) > set->mask + 1) {
+    const address_set_t old = *set;
+    set->mask = old.slots ? 2 * old.mask + 1 : 1023;
+    set->slots = calloc(set->mask + 1, sizeof(uintptr_t));
+    set->size = 0;
+    for (size_t i = 0; old.slots && i <= old.mask; ++i) {
+      if (old.slots[i]) {
+        address_set_insert(set, old.slots[i]);
+      }
+    }
+    free(old.slots);
+  }
+  size_t i = (address * 0x9e3779b97f4a7c15ull) >> 20 & set->mask;
+  for (; set->slots[i]; i = (i + 1) & set->mask) {
+    if (set->slots[i] == address) {
+      return;
+    }
+  }
+  set->slots[i] = address;
+  ++set->size;
+}
+
+static uint64_t pgm_reads = 0;
+static address_set_t pgm_bytes = {0};
+
+static void count_pgm_read(const void* p) {
+  ++pgm_reads;
+  address_set_insert(&pgm_bytes, (uintptr_t)p);
+}
+
+// Runs process_autocorrection() once over `text`, counting the bytes of the
+// dictionary it reads. If the reference dictionary is loaded, checks that each
+// correction matches the reference's, and returns the number that do not.
+static uint32_t check_autocorrect(const char* text, size_t size,
+                                  bool have_reference, uint64_t* presses) {
+  keyrecord_t record = {.event = {.type = KEY_EVENT, .pressed = true}};
+  uint32_t mismatches = 0;
+  *presses = 0;
+  sim_pgm_read_hook = count_pgm_read;
+  for (size_t i = 0; i < size; ++i) {
+    bool shift;
+    const uint16_t keycode = char_to_keycode(text[i], &shift);
+    if (keycode == KC_NO) {
+      continue;
+    }
+    ++*presses;
+    const uint32_t corrections = autocorrect_stats.corrections;
+    if (shift) {
+      add_mods(MOD_BIT_LSHIFT);
+    }
+    record.keycode = keycode;
+    process_autocorrection(keycode, &record);
+    if (shift) {
+      del_mods(MOD_BIT_LSHIFT);
+    }
+    if (!have_reference) {
+      continue;
+    }
+
+    const bool fired = autocorrect_stats.corrections != corrections;
+    uint8_t backspaces = 0;
+    const char* str = NULL;
+    const bool expected =
+        autocorrect_reference_press(keycode, shift, &backspaces, &str);
+    if (fired == expected &&
+        (!fired || (backspaces == autocorrect_stats.last_backspaces &&
+                    strcmp(str, autocorrect_stats.last_str) == 0))) {
+      continue;
+    }
+    if (++mismatches <= 10) {
+      const size_t from = i > 24 ? i - 24 : 0;
+      fprintf(stderr, "sim: autocorrect mismatch at byte %zu, \"%.*s\": ", i,
+              (int)(i + 1 - from), text + from);
+      if (fired) {
+        fprintf(stderr, "%u backspaces + \"%s\"",
+                autocorrect_stats.last_backspaces, autocorrect_stats.last_str);
+      } else {
+        fprintf(stderr, "no correction");
+      }
+      if (expected) {
+        fprintf(stderr, ", expected %u backspaces + \"%s\"\n", backspaces, str);
+      } else {
+        fprintf(stderr, ", expected none\n");
+      }
+    }
+  }
+  sim_pgm_read_hook = NULL;
+  return mismatches;
+}
+
+// Times process_autocorrection() alone on the key presses typing `text`.
+// Unlike the per-handler times of a replay, no clock is read per call. A first,
+// untimed pass counts the corrections and dictionary bytes read, and checks
+// the corrections if a reference dictionary is loaded. Returns false if any
+// correction differs from the reference's.
+static bool bench_autocorrect(const char* text, size_t size, int rounds,
+                              bool have_reference) {
+  uint64_t check_presses;
+  const uint32_t mismatches =
+      check_autocorrect(text, size, have_reference, &check_presses);
+  const uint32_t corrections = autocorrect_stats.corrections;
+
+  uint16_t* keycodes = malloc(size * sizeof(*keycodes));
+  bool* shifts = malloc(size * sizeof(*shifts));
+  size_t n = 0;
+  for (size_t i = 0; i < size; ++i) {
+    if ((keycodes[n] = char_to_keycode(text[i], &shifts[n])) != KC_NO) {
+      ++n;
+    }
+  }
+
+  keyrecord_t record = {.event = {.type = KEY_EVENT, .pressed = true}};
+  time_text_events = false;
+  const uint64_t start_ns = sim_clock_ns();
+  const uint64_t start_cycles = read_cycles();
+  for (int r = 0; r < rounds; ++r) {
+    for (size_t i = 0; i < n; ++i) {
+      if (shifts[i]) {
+        add_mods(MOD_BIT_LSHIFT);
+      }
+      record.keycode = keycodes[i];
+      process_autocorrection(keycodes[i], &record);
+      if (shifts[i]) {
+        del_mods(MOD_BIT_LSHIFT);
+      }
+    }
+  }
+  const uint64_t cycles = read_cycles() - start_cycles;
+  const uint64_t ns = sim_clock_ns() - start_ns;
+  time_text_events = true;
+
+  address_set_t lines = {0};
+  for (size_t i = 0; i <= pgm_bytes.mask && pgm_bytes.slots; ++i) {
+    if (pgm_bytes.slots[i]) {
+      address_set_insert(&lines, pgm_bytes.slots[i] / 64);
+    }
+  }
+
+  const double presses = (double)rounds * n;
+  printf("autocorrect:       %zu key presses x %d rounds\n", n, rounds);
+  printf("autocorrect time:  %.1f ns per key press\n",
+         presses ? ns / presses : 0.0);
+  if (cycles) {
+    printf("autocorrect TSC:   %.1f cycles per key press\n", cycles / presses);
+  }
+  printf("autocorrect reads: %.2f bytes per key press, %zu distinct bytes in "
+         "%zu 64-byte lines\n",
+         check_presses ? (double)pgm_reads / check_presses : 0.0,
+         pgm_bytes.size, lines.size);
+  printf("autocorrect fired: %u corrections (%.2f per 1000 key presses)\n",
+         corrections, check_presses ? 1000.0 * corrections / check_presses : 0.0);
+  if (have_reference) {
+    printf("autocorrect check: %u mismatches with the %u-entry reference\n",
+           mismatches, autocorrect_reference_size());
+  }
+  free(keycodes);
+  free(shifts);
+  free(pgm_bytes.slots);
+  free(lines.slots);
+  return mismatches == 0;
+}
+
+// Times the text features on the key presses typing `text`, each decoding the
+// event itself through its process_*(keycode, record) function, then with one
+// text_event_normalize() shared by their process_*_event() functions.
+static void bench_text_events(const char* text, size_t size, int rounds) {
+  uint16_t* keycodes = malloc(size * sizeof(*keycodes));
+  bool* shifts = malloc(size * sizeof(*shifts));
+  size_t n = 0;
+  for (size_t i = 0; i < size; ++i) {
+    if ((keycodes[n] = char_to_keycode(text[i], &shifts[n])) != KC_NO) {
+      ++n;
+    }
+  }
+
+  keyrecord_t record = {.event = {.type = KEY_EVENT, .pressed = true}};
+  uint64_t ns[2] = {0};
+  time_text_events = false;
+  for (int shared = 0; shared < 2; ++shared) {
+    sentence_case_clear();
+    const uint64_t start_ns = sim_clock_ns();
+    for (int r = 0; r < rounds; ++r) {
+      for (size_t i = 0; i < n; ++i) {
+        const uint16_t keycode = keycodes[i];
+        if (shifts[i]) {
+          add_mods(MOD_BIT_LSHIFT);
+        }
+        record.keycode = keycode;
+        if (shared) {
+          text_event_t event;
+          __real_text_event_normalize(&event, keycode, &record);
+          text_history_append(&event, &record);
+          __real_process_sentence_case_event(&event, &record);
+          __real_process_select_word_event(&event, keycode, &record);
+          process_autocorrection_event(&event, &record);
+        } else {
+          // Only the first adds the key to the text history.
+          text_event_t event;
+          process_sentence_case(keycode, &record);
+          process_select_word(keycode, &record);
+          __real_text_event_normalize(&event, keycode, &record);
+          process_autocorrection_event(&event, &record);
+        }
+        if (shifts[i]) {
+          del_mods(MOD_BIT_LSHIFT);
+        }
+        clear_oneshot_mods();  // As the key's action would, after Sentence Case.
+      }
+    }
+    ns[shared] = sim_clock_ns() - start_ns;
+  }
+  time_text_events = true;
+
+  const double presses = (double)rounds * n;
+  printf("text events:       %zu key presses x %d rounds\n", n, rounds);
+  printf("each decoding:     %.1f ns per key press\n",
+         presses ? ns[0] / presses : 0.0);
+  printf("shared decoding:   %.1f ns per key press (%.1f ns saved)\n",
+         presses ? ns[1] / presses : 0.0,
+         presses ? ((double)ns[0] - (double)ns[1]) / presses : 0.0);
+  free(keycodes);
+  free(shifts);
+}
+
+// Estimates the cost of one SIM_TIMED measurement.
+static uint64_t measure_timer_overhead(void) {
+  enum { N = 100000 };
+  const uint64_t start = sim_clock_ns();
+  for (int i = 0; i < N; ++i) {
+    const uint64_t t0 = sim_clock_ns();
+    (void)(sim_clock_ns() - t0);
+  }
+  return (sim_clock_ns() - start) / N;
+}
+
+static FILE* open_or_die(const char* path, const char* mode) {
+  if (strcmp(path, "-") == 0) {
+    return mode[0] == 'r' ? stdin : stdout;
+  }
+  FILE* f = fopen(path, mode);
+  if (!f) {
+    fprintf(stderr, "sim: %s: %s\n", path, strerror(errno));
+    exit(1);
+  }
+  return f;
+}
+
+#ifdef RAW_ENABLE
+// Passes the raw HID requests in the file at `path`, one per line as hex bytes,
+// to raw_hid_receive().
+static void send_raw_hid(const char* path) {
+  FILE* in = open_or_die(path, "r");
+  char line[256];
+  while (fgets(line, sizeof(line), in)) {
+    uint8_t data[RAW_EPSIZE] = {0};
+    uint8_t n = 0;
+    for (const char* p = line; n < RAW_EPSIZE; ++n) {
+      char* end;
+      data[n] = (uint8_t)strtoul(p, &end, 16);
+      if (end == p) {
+        break;
+      }
+      p = end;
+    }
+    if (n > 0) {
+      raw_hid_receive(data, RAW_EPSIZE);
+    }
+  }
+  fclose(in);
+}
+#endif  // RAW_ENABLE
+
+int main(int argc, char** argv) {
+  const char* trace_path = NULL;
+  const char* text_path = NULL;
+  const char* reports_path = NULL;
+  const char* write_trace_path = NULL;
+#ifdef KEY_TRACE_ENABLE
+  const char* key_trace_path = NULL;
+#endif  // KEY_TRACE_ENABLE
+#ifdef RAW_ENABLE
+  const char* raw_hid_path = NULL;
+#endif  // RAW_ENABLE
+  const char* autocorrect_dict_path = NULL;
+  int wpm = 60;
+  int repeat = 1;
+  int bench_macro_rounds = 0;
+  int bench_layer_rounds = 0;
+  int bench_autocorrect_rounds = 0;
+  int bench_text_event_rounds = 0;
+  bool print_typed = false;
+  os_variant_t os = OS_LINUX;
+
+  for (int i = 1; i < argc; ++i) {
+    const char* arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (strcmp(arg, "--text") == 0 && has_value) {
+      text_path = argv[++i];
+    } else if (strcmp(arg, "--wpm") == 0 && has_value) {
+      wpm = atoi(argv[++i]);
+    } else if (strcmp(arg, "--repeat") == 0 && has_value) {
+      repeat = atoi(argv[++i]);
+    } else if (strcmp(arg, "--reports") == 0 && has_value) {
+      reports_path = argv[++i];
+    } else if (strcmp(arg, "--write-trace") == 0 && has_value) {
+      write_trace_path = argv[++i];
+#ifdef KEY_TRACE_ENABLE
+    } else if (strcmp(arg, "--key-trace") == 0 && has_value) {
+      key_trace_path = argv[++i];
+#endif  // KEY_TRACE_ENABLE
+#ifdef RAW_ENABLE
+    } else if (strcmp(arg, "--raw-hid") == 0 && has_value) {
+      raw_hid_path = argv[++i];
+#endif  // RAW_ENABLE
+    } else if (strcmp(arg, "--bench-macros") == 0 && has_value) {
+      bench_macro_rounds = atoi(argv[++i]);
+    } else if (strcmp(arg, "--bench-layers") == 0 && has_value) {
+      bench_layer_rounds = atoi(argv[++i]);
+    } else if (strcmp(arg, "--bench-autocorrect") == 0 && has_value) {
+      bench_autocorrect_rounds = atoi(argv[++i]);
+    } else if (strcmp(arg, "--bench-text-events") == 0 && has_value) {
+      bench_text_event_rounds = atoi(argv[++i]);
+    } else if (strcmp(arg, "--autocorrect-dict") == 0 && has_value) {
+      autocorrect_dict_path = argv[++i];
+    } else if (strcmp(arg, "--typed") == 0) {
+      print_typed = true;
+    } else if (strcmp(arg, "--os") == 0 && has_value) {
+      const char* name = argv[++i];
+      if (strcmp(name, "linux") == 0) {
+        os = OS_LINUX;
+      } else if (strcmp(name, "windows") == 0) {
+        os = OS_WINDOWS;
+      } else if (strcmp(name, "macos") == 0) {
+        os = OS_MACOS;
+      } else {
+        usage();
+        return 1;
+      }
+    } else if (arg[0] != '-' && !trace_path) {
+      trace_path = arg;
+    } else {
+      usage();
+      return 1;
+    }
+  }
+  if ((bench_macro_rounds > 0 || bench_layer_rounds > 0) && !trace_path &&
+      !text_path) {
+    sim_init(os);
+    if (bench_macro_rounds > 0) {
+      bench_macros(bench_macro_rounds);
+    }
+    if (bench_layer_rounds > 0) {
+      bench_layers(bench_layer_rounds);
+    }
+    return 0;
+  }
+  if (!trace_path == !text_path) {
+    usage();
+    return 1;
+  }
+  if (bench_autocorrect_rounds > 0 || bench_text_event_rounds > 0) {
+    if (!text_path) {
+      usage();
+      return 1;
+    }
+    FILE* in = open_or_die(text_path, "r");
+    char* text = NULL;
+    size_t size = 0;
+    for (size_t n = 1; n > 0; size += n) {
+      text = realloc(text, size + 4096);
+      n = fread(text + size, 1, 4096, in);
+    }
+    if (autocorrect_dict_path &&
+        !autocorrect_reference_load(autocorrect_dict_path)) {
+      return 1;
+    }
+    sim_init(os);
+#ifdef RAW_ENABLE
+    if (raw_hid_path) {
+      send_raw_hid(raw_hid_path);
+    }
+#endif  // RAW_ENABLE
+    bool ok = true;
+    if (bench_autocorrect_rounds > 0) {
+      ok = bench_autocorrect(text, size, bench_autocorrect_rounds,
+                             autocorrect_dict_path != NULL);
+    }
+    if (bench_text_event_rounds > 0) {
+      bench_text_events(text, size, bench_text_event_rounds);
+    }
+    free(text);
+    return ok ? 0 : 1;
+  }
+
+  trace_t trace = {0};
+  if (trace_path) {
+    FILE* in = open_or_die(trace_path, "r");
+    if (!read_trace(in, &trace)) {
+      return 1;
+    }
+  } else {
+    FILE* in = open_or_die(text_path, "r");
+    if (!text_to_trace(in, wpm, &trace)) {
+      return 1;
+    }
+  }
+  if (write_trace_path) {
+    FILE* out = open_or_die(write_trace_path, "w");
+    for (size_t i = 0; i < trace.size; ++i) {
+      const trace_event_t* e = &trace.events[i];
+      fprintf(out, "%u %u %u %c\n", e->time, e->row, e->col,
+              e->pressed ? 'd' : 'u');
+    }
+  }
+
+  sim_init(os);
+  if (reports_path) {
+    sim_set_report_output(open_or_die(reports_path, "w"));
+  }
+#ifdef RAW_ENABLE
+  if (raw_hid_path) {
+    send_raw_hid(raw_hid_path);
+  }
+#endif  // RAW_ENABLE
+
+  const uint64_t start_ns = sim_clock_ns();
+  uint32_t offset = 0;
+  for (int r = 0; r < repeat; ++r) {
+    const uint32_t base = sim_now() + 1000;  // Idle second between repeats.
+    for (size_t i = 0; i < trace.size; ++i) {
+      const trace_event_t* e = &trace.events[i];
+      offset = base + e->time;
+      sim_advance_to(offset);
+      sim_key_event(e->row, e->col, e->pressed);
+    }
+  }
+  sim_advance_to(offset + 5000);  // Let timeouts and deferred tasks finish.
+  const double wall_s = (sim_clock_ns() - start_ns) * 1e-9;
+
+  if (print_typed) {
+    printf("%s\n\n", sim_typed_text());
+  }
+  print_summary(wall_s, measure_timer_overhead());
+#ifdef LATENCY_STATS_ENABLE
+  printf("\n");
+  sim_keymap_print_latency_stats();
+#endif  // LATENCY_STATS_ENABLE
+#ifdef KEY_TRACE_ENABLE
+  printf("key trace:         %u bytes\n", key_trace_size());
+  if (key_trace_path) {
+    uint8_t buffer[KEY_TRACE_BUFFER_SIZE];
+    const uint16_t size = key_trace_read(0, buffer, sizeof(buffer));
+    FILE* out = open_or_die(key_trace_path, "wb");
+    fwrite(buffer, 1, size, out);
+    fclose(out);
+  }
+#endif  // KEY_TRACE_ENABLE
+  return 0;
+}
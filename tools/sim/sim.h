@@ -0,0 +1,158 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file sim.h
+ * @brief Interface between the simulated QMK core and the simulator driver.
+ *
+ * sim_core.c implements the subset of QMK that keymap.c relies on: keymap
+ * lookup through the layer stack, tap-hold resolution (tapping term,
+ * permissive hold, chordal hold, flow tap), mods and one-shot mods, Repeat Key,
+ * send_string, deferred execution and HID report generation. Everything runs
+ * on a virtual millisecond clock that only moves when the driver advances it
+ * or when firmware code calls wait_ms(), so traces replay deterministically.
+ *
+ * Calls into keymap.c and features/ are timed with the host's monotonic clock
+ * and accumulated per handler in `sim_stats`.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "os_detection.h"
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Handlers whose host CPU time is measured. */
+enum sim_stat_id {
+  SIM_STAT_EVENT,  // Whole key event path, including tap-hold resolution.
+  SIM_STAT_PRE_PROCESS_RECORD_USER,
+  SIM_STAT_PROCESS_RECORD_USER,
+  SIM_STAT_TEXT_EVENT,
+  SIM_STAT_SOCD_CLEANER,
+  SIM_STAT_ORBITAL_MOUSE,
+  SIM_STAT_SENTENCE_CASE,
+  SIM_STAT_SELECT_WORD,
+  SIM_STAT_CUSTOM_SHIFT_KEYS,
+  SIM_STAT_MOUSE_TURBO_CLICK,
+  SIM_STAT_CAPS_WORD,
+  SIM_STAT_AUTOCORRECTION,
+  SIM_STAT_LAYER_LOCK,
+  SIM_STAT_HOUSEKEEPING,
+  SIM_STAT_LAYER_STATE_SET,
+  SIM_STAT_TAPPING_TERM,
+  SIM_STAT_CHORDAL_HOLD,
+  SIM_STAT_FLOW_TAP,
+  SIM_STAT_ALT_REPEAT,
+  SIM_STAT_REMEMBER_LAST_KEY,
+  NUM_SIM_STATS,
+};
+
+typedef struct {
+  const char* name;
+  uint64_t calls;
+  uint64_t ns;
+} sim_stat_t;
+
+extern sim_stat_t sim_stats[NUM_SIM_STATS];
+
+static inline uint64_t sim_clock_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static inline void sim_stat_add(int id, uint64_t ns) {
+  ++sim_stats[id].calls;
+  sim_stats[id].ns += ns;
+}
+
+/** Evaluates `call`, charging its host CPU time to stat `id`. */
+#define SIM_TIMED(id, call)                        \
+  ({                                               \
+    const uint64_t sim_t0_ = sim_clock_ns();       \
+    __typeof__(call) sim_r_ = (call);              \
+    sim_stat_add((id), sim_clock_ns() - sim_t0_);  \
+    sim_r_;                                        \
+  })
+#define SIM_TIMED_VOID(id, call)                   \
+  do {                                             \
+    const uint64_t sim_t0_ = sim_clock_ns();       \
+    call;                                          \
+    sim_stat_add((id), sim_clock_ns() - sim_t0_);  \
+  } while (0)
+
+/** Resets the simulated keyboard and calls keyboard_post_init_user(). */
+void sim_init(os_variant_t os);
+
+/** Current virtual time in milliseconds. */
+uint32_t sim_now(void);
+
+/**
+ * Advances the virtual clock to `time_ms`, running the matrix scan tasks
+ * (tap-hold timeouts, deferred execution, housekeeping) once per millisecond.
+ * Does nothing if the clock is already past `time_ms`, which happens when
+ * firmware code blocked in wait_ms() for longer than the gap between events.
+ */
+void sim_advance_to(uint32_t time_ms);
+
+/** Feeds a physical key press or release at the current virtual time. */
+void sim_key_event(uint8_t row, uint8_t col, bool pressed);
+
+/** Keycode at a matrix position as resolved through the current layers. */
+uint16_t sim_resolve_keycode(uint8_t row, uint8_t col);
+
+/** Number of layers in keymap.c's `keymaps` array. */
+uint8_t sim_keymap_layer_count(void);
+
+/**
+ * Gets the range of keymap.c's macro keycodes, MC_COMMENT to MC_PANE_RIGHT,
+ * used by the macro dispatch benchmark.
+ */
+void sim_keymap_macro_range(uint16_t* first, uint16_t* last);
+
+/** Prints keymap.c's Latency Stats, when built with LATENCY_STATS_ENABLE. */
+void sim_keymap_print_latency_stats(void);
+
+/**
+ * Sets where HID reports are written, one line per report. NULL disables
+ * report output, which is what benchmarks should use.
+ */
+void sim_set_report_output(FILE* out);
+
+/** Text the host would have received, with backspaces applied. */
+const char* sim_typed_text(void);
+
+/** Totals collected while replaying. */
+typedef struct {
+  uint64_t key_events;
+  uint64_t keyboard_reports;
+  uint64_t mouse_reports;
+  /** Virtual ms spent blocked inside wait_ms() with scanning stalled. */
+  uint64_t blocked_ms;
+  /** Longest single stall, from one event or task, in virtual ms. */
+  uint32_t longest_stall_ms;
+} sim_counters_t;
+
+extern sim_counters_t sim_counters;
+
+#ifdef __cplusplus
+}
+#endif
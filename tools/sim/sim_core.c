@@ -0,0 +1,1164 @@
+// Copyright 2026 Artur Gomes
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file sim_core.c
+ * @brief Simulated QMK core for the host build.
+ *
+ * This is a small model of the parts of QMK that keymap.c depends on. It is
+ * not a port of QMK: tap-hold resolution, one-shot mods and Repeat Key are
+ * reimplemented following QMK's documented behavior closely enough that the
+ * keymap's handlers see the same sequence of (keycode, record) events they
+ * would see on the keyboard. Combos, Tap Dance, Speculative Hold, encoders and
+ * lighting are not simulated.
+ */
+
+#include "sim.h"
+
+#include <stdlib.h>
+
+#include "features/autocorrection.h"
+#include "features/autocorrection_flash.h"
+#include "features/caps_word.h"
+#include "features/layer_lock.h"
+
+extern const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS];
+
+bool debug_enable = false;
+void (*sim_pgm_read_hook)(const void* p) = NULL;
+layer_state_t layer_state = 0;
+layer_state_t default_layer_state = 0;
+sim_stat_t sim_stats[NUM_SIM_STATS] = {
+    [SIM_STAT_EVENT] = {"key event (total)"},
+    [SIM_STAT_PRE_PROCESS_RECORD_USER] = {"pre_process_record_user"},
+    [SIM_STAT_PROCESS_RECORD_USER] = {"process_record_user"},
+    [SIM_STAT_TEXT_EVENT] = {"  text_event_normalize"},
+    [SIM_STAT_SOCD_CLEANER] = {"  process_socd_cleaner"},
+    [SIM_STAT_ORBITAL_MOUSE] = {"  process_orbital_mouse"},
+    [SIM_STAT_SENTENCE_CASE] = {"  process_sentence_case_event"},
+    [SIM_STAT_SELECT_WORD] = {"  process_select_word_event"},
+    [SIM_STAT_CUSTOM_SHIFT_KEYS] = {"  process_custom_shift_keys"},
+    [SIM_STAT_MOUSE_TURBO_CLICK] = {"  process_mouse_turbo_click"},
+    [SIM_STAT_CAPS_WORD] = {"process_caps_word"},
+    [SIM_STAT_AUTOCORRECTION] = {"process_autocorrection"},
+    [SIM_STAT_LAYER_LOCK] = {"process_layer_lock"},
+    [SIM_STAT_HOUSEKEEPING] = {"housekeeping_task_user"},
+    [SIM_STAT_LAYER_STATE_SET] = {"layer_state_set_user"},
+    [SIM_STAT_TAPPING_TERM] = {"get_tapping_term"},
+    [SIM_STAT_CHORDAL_HOLD] = {"get_chordal_hold"},
+    [SIM_STAT_FLOW_TAP] = {"get_flow_tap_term"},
+    [SIM_STAT_ALT_REPEAT] = {"get_alt_repeat_key_keycode_user"},
+    [SIM_STAT_REMEMBER_LAST_KEY] = {"remember_last_key_user"},
+};
+sim_counters_t sim_counters = {0};
+
+// Virtual clock in milliseconds.
+static uint32_t now_ms = 0;
+// Clock value when the current stall began, used for `longest_stall_ms`.
+static uint32_t stall_start_ms = 0;
+static os_variant_t host_os = OS_UNSURE;
+static FILE* report_out = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Timers.
+////////////////////////////////////////////////////////////////////////////////
+
+uint32_t sim_now(void) { return now_ms; }
+uint16_t timer_read(void) { return (uint16_t)now_ms; }
+uint32_t timer_read32(void) { return now_ms; }
+uint32_t timer_read_us(void) { return now_ms * 1000; }
+uint16_t timer_elapsed(uint16_t last) { return (uint16_t)now_ms - last; }
+uint32_t timer_elapsed32(uint32_t last) { return now_ms - last; }
+
+void wait_ms(uint32_t ms) {
+  // Blocking waits advance the clock without scanning the matrix or running
+  // housekeeping, as on the keyboard.
+  now_ms += ms;
+  sim_counters.blocked_ms += ms;
+}
+
+void wait_us(uint32_t us) { wait_ms(us / 1000); }
+
+os_variant_t detected_host_os(void) { return host_os; }
+
+__attribute__((weak)) bool process_detected_host_os_user(
+    os_variant_t detected_os) {
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Reports and typed text.
+////////////////////////////////////////////////////////////////////////////////
+
+static uint8_t real_mods = 0;
+static uint8_t weak_mods = 0;
+static uint8_t oneshot_mods = 0;
+static report_keyboard_t report = {0};
+static report_keyboard_t last_sent = {0};
+static uint8_t mouse_buttons = 0;
+
+static char* typed = NULL;
+static size_t typed_len = 0;
+static size_t typed_cap = 0;
+
+static void typed_append(const char* s) {
+  const size_t n = strlen(s);
+  if (typed_len + n + 1 > typed_cap) {
+    typed_cap = (typed_len + n + 1) * 2;
+    typed = realloc(typed, typed_cap);
+  }
+  memcpy(typed + typed_len, s, n + 1);
+  typed_len += n;
+}
+
+const char* sim_typed_text(void) { return typed ? typed : ""; }
+
+// US ANSI layout, unshifted and shifted characters for KC_A to KC_SLSH.
+static const char unshifted_chars[] =
+    "abcdefghijklmnopqrstuvwxyz1234567890\n\0\b\t -=[]\\#;'`,./";
+static const char shifted_chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ!@#$%^&*()\n\0\b\t _+{}|~:\"~<>?";
+
+// Appends to the typed text what a host would type for newly pressed `key`.
+static void type_key(uint8_t key, uint8_t mods) {
+  if (key == KC_BSPC && !(mods & (MOD_MASK_CTRL | MOD_MASK_ALT | MOD_MASK_GUI))) {
+    if (typed_len > 0) {
+      typed[--typed_len] = '\0';
+    }
+    return;
+  }
+  if (KC_A <= key && key <= KC_SLSH && key != KC_ESC &&
+      !(mods & (MOD_MASK_CTRL | MOD_MASK_ALT | MOD_MASK_GUI))) {
+    const char c = ((mods & MOD_MASK_SHIFT) ? shifted_chars
+                                            : unshifted_chars)[key - KC_A];
+    const char s[2] = {c, '\0'};
+    typed_append(s);
+    return;
+  }
+  if (IS_MODIFIER_KEYCODE(key)) {
+    return;
+  }
+  // Hotkeys and non-printing keys are shown as <mods+key>, e.g. <C-2c>.
+  char s[16];
+  snprintf(s, sizeof(s), "<%s%s%s%s%02x>",
+           (mods & MOD_MASK_CTRL) ? "C-" : "", (mods & MOD_MASK_ALT) ? "A-" : "",
+           (mods & MOD_MASK_GUI) ? "G-" : "",
+           (mods & MOD_MASK_SHIFT) ? "S-" : "", key);
+  typed_append(s);
+}
+
+void sim_set_report_output(FILE* out) { report_out = out; }
+
+void send_keyboard_report(void) {
+  report.mods = real_mods | weak_mods | oneshot_mods;
+  if (memcmp(&report, &last_sent, sizeof(report)) == 0) {
+    return;
+  }
+  for (int i = 0; i < KEYBOARD_REPORT_KEYS; ++i) {
+    const uint8_t key = report.keys[i];
+    if (key && !memchr(last_sent.keys, key, KEYBOARD_REPORT_KEYS)) {
+      type_key(key, report.mods);
+    }
+  }
+  last_sent = report;
+  ++sim_counters.keyboard_reports;
+  if (report_out) {
+    fprintf(report_out, "%u kbd %02x", now_ms, report.mods);
+    for (int i = 0; i < KEYBOARD_REPORT_KEYS; ++i) {
+      if (report.keys[i]) {
+        fprintf(report_out, " %02x", report.keys[i]);
+      }
+    }
+    fputc('\n', report_out);
+  }
+}
+
+void host_mouse_send(report_mouse_t* mouse) {
+  ++sim_counters.mouse_reports;
+  if (report_out) {
+    fprintf(report_out, "%u mouse %02x %d %d %d %d\n", now_ms, mouse->buttons,
+            mouse->x, mouse->y, mouse->v, mouse->h);
+  }
+}
+
+void raw_hid_send(uint8_t* data, uint8_t length) {
+  if (report_out) {
+    fprintf(report_out, "%u raw", now_ms);
+    for (uint8_t i = 0; i < length; ++i) {
+      fprintf(report_out, " %02x", data[i]);
+    }
+    fputc('\n', report_out);
+  }
+}
+
+#ifdef AUTOCORRECTION_FLASH_ENABLE
+// Flash for Autocorrection Flash, erased at power on. As on the chip,
+// programming only clears bits.
+static uint8_t autocorrection_flash[2 * AUTOCORRECTION_FLASH_SLOT_SIZE];
+
+const uint8_t* autocorrection_flash_memory(void) {
+  return autocorrection_flash;
+}
+
+void autocorrection_flash_erase(uint32_t offset, uint32_t size) {
+  memset(autocorrection_flash + offset, 0xff, size);
+}
+
+void autocorrection_flash_program(uint32_t offset, const uint8_t* data,
+                                  uint32_t size) {
+  for (uint32_t i = 0; i < size; ++i) {
+    autocorrection_flash[offset + i] &= data[i];
+  }
+}
+#endif  // AUTOCORRECTION_FLASH_ENABLE
+
+static void send_mouse_buttons(void) {
+  report_mouse_t mouse = {.buttons = mouse_buttons};
+  host_mouse_send(&mouse);
+}
+
+void add_key(uint8_t key) {
+  for (int i = 0; i < KEYBOARD_REPORT_KEYS; ++i) {
+    if (report.keys[i] == key) {
+      return;
+    }
+  }
+  for (int i = 0; i < KEYBOARD_REPORT_KEYS; ++i) {
+    if (!report.keys[i]) {
+      report.keys[i] = key;
+      return;
+    }
+  }
+}
+
+void del_key(uint8_t key) {
+  for (int i = 0; i < KEYBOARD_REPORT_KEYS; ++i) {
+    if (report.keys[i] == key) {
+      report.keys[i] = 0;
+    }
+  }
+}
+
+void clear_keys(void) { memset(report.keys, 0, sizeof(report.keys)); }
+
+////////////////////////////////////////////////////////////////////////////////
+// Mods.
+////////////////////////////////////////////////////////////////////////////////
+
+uint8_t get_mods(void) { return real_mods; }
+void add_mods(uint8_t mods) { real_mods |= mods; }
+void del_mods(uint8_t mods) { real_mods &= ~mods; }
+void set_mods(uint8_t mods) { real_mods = mods; }
+void clear_mods(void) { real_mods = 0; }
+uint8_t get_weak_mods(void) { return weak_mods; }
+void add_weak_mods(uint8_t mods) { weak_mods |= mods; }
+void del_weak_mods(uint8_t mods) { weak_mods &= ~mods; }
+void set_weak_mods(uint8_t mods) { weak_mods = mods; }
+void clear_weak_mods(void) { weak_mods = 0; }
+uint8_t get_oneshot_mods(void) { return oneshot_mods; }
+void add_oneshot_mods(uint8_t mods) { oneshot_mods |= mods; }
+void del_oneshot_mods(uint8_t mods) { oneshot_mods &= ~mods; }
+void set_oneshot_mods(uint8_t mods) { oneshot_mods = mods; }
+void clear_oneshot_mods(void) { oneshot_mods = 0; }
+uint8_t get_oneshot_layer(void) { return 0; }
+void reset_oneshot_layer(void) {}
+
+void register_mods(uint8_t mods) {
+  add_mods(mods);
+  send_keyboard_report();
+}
+
+void unregister_mods(uint8_t mods) {
+  del_mods(mods);
+  send_keyboard_report();
+}
+
+void register_weak_mods(uint8_t mods) {
+  add_weak_mods(mods);
+  send_keyboard_report();
+}
+
+void unregister_weak_mods(uint8_t mods) {
+  del_weak_mods(mods);
+  send_keyboard_report();
+}
+
+// Converts 5-bit keycode mods to 8-bit report mods.
+static uint8_t mods_5bit_to_8bit(uint8_t mods) {
+  return (mods & 0x10) ? (uint8_t)((mods & 0x0F) << 4) : (mods & 0x0F);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Registering keycodes.
+////////////////////////////////////////////////////////////////////////////////
+
+void register_code(uint8_t code) {
+  if (code == KC_NO || code == KC_TRNS) {
+    return;
+  } else if (IS_MODIFIER_KEYCODE(code)) {
+    add_mods(MOD_BIT(code));
+  } else if (MS_BTN1 <= code && code <= MS_BTN8) {
+    mouse_buttons |= 1 << (code - MS_BTN1);
+    send_mouse_buttons();
+    return;
+  } else if (IS_MOUSE_KEYCODE(code)) {
+    return;  // Mouse Keys movement is not simulated.
+  } else {
+    add_key(code);
+    if (oneshot_mods) {
+      // One-shot mods apply to this key, then are consumed.
+      send_keyboard_report();
+      clear_oneshot_mods();
+      return;
+    }
+  }
+  send_keyboard_report();
+}
+
+void unregister_code(uint8_t code) {
+  if (code == KC_NO || code == KC_TRNS) {
+    return;
+  } else if (IS_MODIFIER_KEYCODE(code)) {
+    del_mods(MOD_BIT(code));
+  } else if (MS_BTN1 <= code && code <= MS_BTN8) {
+    mouse_buttons &= ~(1 << (code - MS_BTN1));
+    send_mouse_buttons();
+    return;
+  } else if (IS_MOUSE_KEYCODE(code)) {
+    return;
+  } else {
+    del_key(code);
+  }
+  send_keyboard_report();
+}
+
+void register_code16(uint16_t code) {
+  if (IS_QK_MODS(code)) {
+    const uint8_t mods = mods_5bit_to_8bit(QK_MODS_GET_MODS(code));
+    const uint8_t key = QK_MODS_GET_BASIC_KEYCODE(code);
+    if (IS_MODIFIER_KEYCODE(key) || key == KC_NO) {
+      register_mods(mods);
+    } else {
+      register_weak_mods(mods);
+    }
+    register_code(key);
+  } else {
+    register_code((uint8_t)code);
+  }
+}
+
+void unregister_code16(uint16_t code) {
+  unregister_code((uint8_t)code);
+  if (IS_QK_MODS(code)) {
+    const uint8_t mods = mods_5bit_to_8bit(QK_MODS_GET_MODS(code));
+    const uint8_t key = QK_MODS_GET_BASIC_KEYCODE(code);
+    if (IS_MODIFIER_KEYCODE(key) || key == KC_NO) {
+      unregister_mods(mods);
+    } else {
+      unregister_weak_mods(mods);
+    }
+  }
+}
+
+void tap_code_delay(uint8_t code, uint16_t delay) {
+  register_code(code);
+  wait_ms(delay);
+  unregister_code(code);
+}
+
+void tap_code(uint8_t code) { tap_code_delay(code, TAP_CODE_DELAY); }
+
+void tap_code16_delay(uint16_t code, uint16_t delay) {
+  register_code16(code);
+  wait_ms(delay);
+  unregister_code16(code);
+}
+
+void tap_code16(uint16_t code) { tap_code16_delay(code, TAP_CODE_DELAY); }
+
+uint16_t get_tap_keycode(uint16_t keycode) {
+  if (IS_QK_MOD_TAP(keycode)) {
+    return QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+  } else if (IS_QK_LAYER_TAP(keycode)) {
+    return QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+  }
+  return keycode;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Send string.
+////////////////////////////////////////////////////////////////////////////////
+
+// US ANSI layout tables, in the format of QMK's send_string_keycodes.h.
+// clang-format off
+const uint8_t ascii_to_shift_lut[16] = {
+    0x00, 0x00, 0x00, 0x00, 0x7e, 0x0f, 0x00, 0xd4,
+    0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x78,
+};
+const uint8_t ascii_to_altgr_lut[16] = {0};
+const uint8_t ascii_to_keycode_lut[128] = {
+    KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,
+    KC_BSPC,  KC_TAB,   KC_ENT,   KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,
+    KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,    KC_NO,
+    KC_NO,    KC_NO,    KC_NO,    KC_ESC,   KC_NO,    KC_NO,    KC_NO,    KC_NO,
+    KC_SPC,   KC_1,     KC_QUOT,  KC_3,     KC_4,     KC_5,     KC_7,     KC_QUOT,
+    KC_9,     KC_0,     KC_8,     KC_EQL,   KC_COMM,  KC_MINS,  KC_DOT,   KC_SLSH,
+    KC_0,     KC_1,     KC_2,     KC_3,     KC_4,     KC_5,     KC_6,     KC_7,
+    KC_8,     KC_9,     KC_SCLN,  KC_SCLN,  KC_COMM,  KC_EQL,   KC_DOT,   KC_SLSH,
+    KC_2,     KC_A,     KC_B,     KC_C,     KC_D,     KC_E,     KC_F,     KC_G,
+    KC_H,     KC_I,     KC_J,     KC_K,     KC_L,     KC_M,     KC_N,     KC_O,
+    KC_P,     KC_Q,     KC_R,     KC_S,     KC_T,     KC_U,     KC_V,     KC_W,
+    KC_X,     KC_Y,     KC_Z,     KC_LBRC,  KC_BSLS,  KC_RBRC,  KC_6,     KC_MINS,
+    KC_GRV,   KC_A,     KC_B,     KC_C,     KC_D,     KC_E,     KC_F,     KC_G,
+    KC_H,     KC_I,     KC_J,     KC_K,     KC_L,     KC_M,     KC_N,     KC_O,
+    KC_P,     KC_Q,     KC_R,     KC_S,     KC_T,     KC_U,     KC_V,     KC_W,
+    KC_X,     KC_Y,     KC_Z,     KC_LBRC,  KC_BSLS,  KC_RBRC,  KC_GRV,   KC_DEL,
+};
+// clang-format on
+
+void send_char(char ascii_code) {
+  const uint8_t i = (uint8_t)ascii_code & 0x7f;
+  const uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[i]);
+  const bool shifted = PGM_LOADBIT(ascii_to_shift_lut, i);
+  if (keycode == KC_NO) {
+    return;
+  }
+  if (shifted) {
+    register_code(KC_LSFT);
+  }
+  tap_code(keycode);
+  if (shifted) {
+    unregister_code(KC_LSFT);
+  }
+}
+
+void send_string_with_delay(const char* string, uint8_t interval) {
+  for (; *string; ++string) {
+    if (*string == SS_QMK_PREFIX) {
+      const uint8_t code = *(++string);
+      if (code == SS_TAP_CODE || code == SS_DOWN_CODE || code == SS_UP_CODE) {
+        const uint8_t keycode = *(++string);
+        if (code == SS_TAP_CODE) {
+          tap_code(keycode);
+        } else if (code == SS_DOWN_CODE) {
+          register_code(keycode);
+        } else {
+          unregister_code(keycode);
+        }
+      } else if (code == SS_DELAY_CODE) {
+        uint32_t ms = 0;
+        for (++string; '0' <= *string && *string <= '9'; ++string) {
+          ms = ms * 10 + (*string - '0');
+        }
+        wait_ms(ms);
+      }
+    } else {
+      send_char(*string);
+    }
+    wait_ms(interval);
+  }
+}
+
+void send_string_with_delay_P(const char* string, uint8_t interval) {
+  send_string_with_delay(string, interval);
+}
+
+void send_string(const char* string) { send_string_with_delay(string, 0); }
+void send_string_P(const char* string) { send_string_with_delay(string, 0); }
+
+static uint8_t unicode_input_mode = UNICODE_MODE_LINUX;
+
+void set_unicode_input_mode(uint8_t mode) { unicode_input_mode = mode; }
+uint8_t get_unicode_input_mode(void) { return unicode_input_mode; }
+
+void send_unicode_string(const char* string) {
+  typed_append(string);
+  if (report_out) {
+    fprintf(report_out, "%u unicode", now_ms);
+    for (; *string; ++string) {
+      fprintf(report_out, " %02x", (uint8_t)*string);
+    }
+    fputc('\n', report_out);
+  }
+}
+
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Layers.
+////////////////////////////////////////////////////////////////////////////////
+
+bool layer_state_is(uint8_t layer) { return IS_LAYER_ON_STATE(layer_state, layer); }
+
+void layer_state_set(layer_state_t state) {
+  layer_state = SIM_TIMED(SIM_STAT_LAYER_STATE_SET, layer_state_set_user(state));
+}
+
+void layer_on(uint8_t layer) {
+  layer_state_set(layer_state | ((layer_state_t)1 << layer));
+}
+
+void layer_off(uint8_t layer) {
+  layer_state_set(layer_state & ~((layer_state_t)1 << layer));
+}
+
+void layer_move(uint8_t layer) { layer_state_set((layer_state_t)1 << layer); }
+
+void layer_invert(uint8_t layer) {
+  layer_state_set(layer_state ^ ((layer_state_t)1 << layer));
+}
+
+void layer_and(layer_state_t state) { layer_state_set(layer_state & state); }
+void layer_or(layer_state_t state) { layer_state_set(layer_state | state); }
+void layer_clear(void) { layer_state_set(0); }
+
+// keymap.c defines default_layer_state_set_user() only with some features
+// enabled.
+__attribute__((weak)) layer_state_t default_layer_state_set_user(
+    layer_state_t state) {
+  return state;
+}
+
+void default_layer_set(layer_state_t state) {
+  default_layer_state = default_layer_state_set_user(state);
+  // QMK calls layer_state_set_user indirectly through the layer update that
+  // follows a default layer change.
+  layer_state_set(layer_state);
+}
+
+uint8_t get_highest_layer(layer_state_t state) {
+  return state ? (uint8_t)(31 - __builtin_clz(state)) : 0;
+}
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+  if (layer >= sim_keymap_layer_count()) {
+    return KC_TRNS;
+  }
+  return pgm_read_word(&keymaps[layer][key.row][key.col]);
+}
+
+// Source layer of each held key, so that the release resolves to the same
+// keycode as the press even if layers changed in between.
+static uint8_t source_layers[MATRIX_ROWS][MATRIX_COLS];
+
+static uint8_t layer_switch_get_layer(keypos_t key) {
+  layer_state_t layers = layer_state | default_layer_state;
+  for (int8_t i = 31; i >= 0; --i) {
+    if (layers & ((layer_state_t)1 << i)) {
+      if (keymap_key_to_keycode(i, key) != KC_TRNS) {
+        return i;
+      }
+    }
+  }
+  return 0;
+}
+
+uint16_t sim_resolve_keycode(uint8_t row, uint8_t col) {
+  const keypos_t key = {.col = col, .row = row};
+  return keymap_key_to_keycode(layer_switch_get_layer(key), key);
+}
+
+uint8_t read_source_layers_cache(keypos_t key) {
+  return source_layers[key.row][key.col];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Deferred execution.
+////////////////////////////////////////////////////////////////////////////////
+
+#define MAX_DEFERRED_EXECUTORS 8
+
+static struct {
+  deferred_token token;
+  uint32_t due;
+  deferred_exec_callback callback;
+  void* cb_arg;
+} executors[MAX_DEFERRED_EXECUTORS];
+static deferred_token last_token = 0;
+
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback,
+                          void* cb_arg) {
+  for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+    if (executors[i].token == INVALID_DEFERRED_TOKEN) {
+      if (++last_token == INVALID_DEFERRED_TOKEN) {
+        ++last_token;
+      }
+      executors[i].token = last_token;
+      executors[i].due = now_ms + delay_ms;
+      executors[i].callback = callback;
+      executors[i].cb_arg = cb_arg;
+      return last_token;
+    }
+  }
+  return INVALID_DEFERRED_TOKEN;
+}
+
+bool cancel_deferred_exec(deferred_token token) {
+  for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+    if (token != INVALID_DEFERRED_TOKEN && executors[i].token == token) {
+      executors[i].token = INVALID_DEFERRED_TOKEN;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void deferred_exec_task(void) {
+  for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+    if (executors[i].token != INVALID_DEFERRED_TOKEN &&
+        timer_expired32(now_ms, executors[i].due)) {
+      const uint32_t delay =
+          executors[i].callback(executors[i].due, executors[i].cb_arg);
+      if (delay) {
+        executors[i].due = now_ms + delay;
+      } else {
+        executors[i].token = INVALID_DEFERRED_TOKEN;
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Repeat Key.
+////////////////////////////////////////////////////////////////////////////////
+
+static uint16_t last_keycode = KC_NO;
+static uint8_t last_mods = 0;
+static int8_t last_repeat_count = 0;
+static int8_t processing_repeat_count = 0;
+
+int8_t get_repeat_key_count(void) { return processing_repeat_count; }
+uint16_t get_last_keycode(void) { return last_keycode; }
+uint8_t get_last_mods(void) { return last_mods; }
+void set_last_keycode(uint16_t keycode) { last_keycode = keycode; }
+void set_last_mods(uint8_t mods) { last_mods = mods; }
+
+uint16_t get_alt_repeat_key_keycode(void) {
+  uint16_t keycode = last_keycode;
+  uint8_t mods = last_mods;
+  if (keycode == KC_NO) {
+    return KC_NO;
+  }
+  if (IS_QK_MODS(keycode)) {
+    mods |= mods_5bit_to_8bit(QK_MODS_GET_MODS(keycode));
+    keycode = QK_MODS_GET_BASIC_KEYCODE(keycode);
+  }
+  const uint16_t alt_keycode = SIM_TIMED(
+      SIM_STAT_ALT_REPEAT, get_alt_repeat_key_keycode_user(keycode, mods));
+  if (alt_keycode != KC_TRNS) {
+    return alt_keycode;
+  }
+  // A few of QMK's default alternate pairs.
+  switch (get_tap_keycode(keycode)) {
+    case KC_LEFT: return KC_RGHT;
+    case KC_RGHT: return KC_LEFT;
+    case KC_UP: return KC_DOWN;
+    case KC_DOWN: return KC_UP;
+    case KC_HOME: return KC_END;
+    case KC_END: return KC_HOME;
+    case KC_PGUP: return KC_PGDN;
+    case KC_PGDN: return KC_PGUP;
+  }
+  return KC_NO;
+}
+
+static void process_record_with_keycode(uint16_t keycode, keyrecord_t* record);
+
+static void process_last_key(uint16_t keycode, keyrecord_t* record) {
+  if (processing_repeat_count || !record->event.pressed) {
+    return;
+  }
+  switch (keycode) {
+    case QK_REPEAT_KEY:
+    case QK_ALT_REPEAT_KEY:
+    case MODIFIER_KEYCODE_RANGE:
+    case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+    case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:
+    case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+    case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+    case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
+    case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+    case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
+      return;
+    case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+    case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+      if (record->tap.count == 0) {
+        return;
+      }
+      break;
+  }
+  uint8_t remembered_mods = real_mods | weak_mods | oneshot_mods;
+  if (SIM_TIMED(SIM_STAT_REMEMBER_LAST_KEY,
+                remember_last_key_user(keycode, record, &remembered_mods))) {
+    last_keycode = keycode;
+    last_mods = remembered_mods;
+    last_repeat_count = 0;
+  }
+}
+
+// Plumbs the (alternate) repeated keycode into the event pipeline.
+static bool process_repeat_key(uint16_t keycode, keyrecord_t* record) {
+  static keyrecord_t registered_record = {0};
+  static int8_t registered_repeat_count = 0;
+  static bool registered_weak_mods = false;
+
+  if (processing_repeat_count ||
+      (keycode != QK_REPEAT_KEY && keycode != QK_ALT_REPEAT_KEY)) {
+    return true;
+  }
+
+  if (record->event.pressed) {
+    if (keycode == QK_REPEAT_KEY) {
+      if (last_keycode == KC_NO) {
+        return false;
+      }
+      last_repeat_count = last_repeat_count > 0 ? last_repeat_count + 1 : 1;
+      register_weak_mods(last_mods);
+      registered_weak_mods = true;
+      registered_record.keycode = last_keycode;
+    } else {
+      registered_record.keycode = get_alt_repeat_key_keycode();
+      if (registered_record.keycode == KC_NO) {
+        return false;
+      }
+      last_repeat_count = last_repeat_count < 0 ? last_repeat_count - 1 : -1;
+      registered_weak_mods = false;
+    }
+    registered_repeat_count = last_repeat_count;
+  } else if (registered_record.keycode == KC_NO) {
+    return false;
+  }
+
+  registered_record.event = record->event;
+  registered_record.tap = record->tap;
+  processing_repeat_count = registered_repeat_count;
+  process_record_with_keycode(registered_record.keycode, &registered_record);
+  processing_repeat_count = 0;
+
+  if (!record->event.pressed) {
+    if (registered_weak_mods) {
+      unregister_weak_mods(last_mods);
+      registered_weak_mods = false;
+    }
+    registered_record.keycode = KC_NO;
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Event pipeline.
+////////////////////////////////////////////////////////////////////////////////
+
+// Default handling of a keycode, after all handlers returned true.
+static void process_action_keycode(uint16_t keycode, keyrecord_t* record) {
+  const bool pressed = record->event.pressed;
+  switch (keycode) {
+    case QK_BASIC ... QK_BASIC_MAX:
+      if (pressed) {
+        register_code((uint8_t)keycode);
+      } else {
+        unregister_code((uint8_t)keycode);
+      }
+      break;
+
+    case QK_MODS ... QK_MODS_MAX:
+      if (pressed) {
+        register_code16(keycode);
+      } else {
+        unregister_code16(keycode);
+      }
+      break;
+
+    case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+      if (record->tap.count > 0) {
+        process_action_keycode(QK_MOD_TAP_GET_TAP_KEYCODE(keycode), record);
+      } else if (pressed) {
+        register_mods(mods_5bit_to_8bit(QK_MOD_TAP_GET_MODS(keycode)));
+      } else {
+        unregister_mods(mods_5bit_to_8bit(QK_MOD_TAP_GET_MODS(keycode)));
+      }
+      break;
+
+    case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+      if (record->tap.count > 0) {
+        process_action_keycode(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode), record);
+      } else if (pressed) {
+        layer_on(QK_LAYER_TAP_GET_LAYER(keycode));
+      } else {
+        layer_off(QK_LAYER_TAP_GET_LAYER(keycode));
+      }
+      break;
+
+    case QK_TO ... QK_TO_MAX:
+      if (pressed) {
+        layer_move(QK_TO_GET_LAYER(keycode));
+      }
+      break;
+
+    case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+      if (pressed) {
+        layer_on(QK_MOMENTARY_GET_LAYER(keycode));
+      } else {
+        layer_off(QK_MOMENTARY_GET_LAYER(keycode));
+      }
+      break;
+
+    case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:
+      if (pressed) {
+        default_layer_set((layer_state_t)1 << QK_DEF_LAYER_GET_LAYER(keycode));
+      }
+      break;
+
+    case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+      if (pressed) {
+        layer_invert(QK_TOGGLE_LAYER_GET_LAYER(keycode));
+      }
+      break;
+
+    case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
+      if (pressed) {
+        add_oneshot_mods(
+            mods_5bit_to_8bit(QK_ONE_SHOT_MOD_GET_MODS(keycode)));
+        send_keyboard_report();
+      }
+      break;
+
+    case QK_CAPS_WORD_TOGGLE:
+      if (pressed) {
+        caps_word_toggle();
+      }
+      break;
+
+    default:  // QK_BOOT, RGB Matrix and other keycodes have no effect here.
+      break;
+  }
+}
+
+#ifdef AUTOCORRECT_ENABLE
+// As in QMK core, the correction is tapped unless the keymap sends it.
+__attribute__((weak)) bool apply_autocorrect(uint8_t backspaces,
+                                             const char* str, char* typo,
+                                             char* correct) {
+  return true;
+}
+
+// Stands in for QMK core's Autocorrect with features/autocorrection.c, built
+// with AUTOCORRECTION_RECASE_SIZE 0 so that, as in QMK core, corrections are
+// sent as written in the dictionary. Unlike process_autocorrection(), it leaves
+// the text history to keymap.c, which has added the key by the time QMK core's
+// handler would run.
+static bool process_autocorrection_in_core(uint16_t keycode,
+                                           keyrecord_t* record) {
+  if (!record->event.pressed) {
+    return true;
+  }
+  text_event_t event;
+  text_event_normalize(&event, keycode, record);
+  return process_autocorrection_event(&event, record);
+}
+#endif  // AUTOCORRECT_ENABLE
+
+static void process_record_with_keycode(uint16_t keycode, keyrecord_t* record) {
+  record->keycode = keycode;
+  process_last_key(keycode, record);
+  if (!process_repeat_key(keycode, record)) {
+    return;
+  }
+#ifdef CAPS_WORD_ENABLE
+  if (!SIM_TIMED(SIM_STAT_CAPS_WORD, process_caps_word(keycode, record))) {
+    return;
+  }
+#endif  // CAPS_WORD_ENABLE
+  if (!SIM_TIMED(SIM_STAT_PROCESS_RECORD_USER,
+                 process_record_user(keycode, record))) {
+    return;
+  }
+#ifdef AUTOCORRECT_ENABLE
+  if (!SIM_TIMED(SIM_STAT_AUTOCORRECTION,
+                 process_autocorrection_in_core(keycode, record))) {
+    return;
+  }
+#endif  // AUTOCORRECT_ENABLE
+#ifdef LAYER_LOCK_ENABLE
+  if (!SIM_TIMED(SIM_STAT_LAYER_LOCK,
+                 process_layer_lock(keycode, record, QK_LLCK))) {
+    return;
+  }
+#endif  // LAYER_LOCK_ENABLE
+  process_action_keycode(keycode, record);
+}
+
+// Keycode each held key was pressed with and its resolved tap count.
+static uint16_t pressed_keycodes[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t tap_counts[MATRIX_ROWS][MATRIX_COLS];
+
+void process_record(keyrecord_t* record) {
+  const keypos_t key = record->event.key;
+  if (record->event.pressed) {
+    source_layers[key.row][key.col] = layer_switch_get_layer(key);
+    pressed_keycodes[key.row][key.col] =
+        keymap_key_to_keycode(source_layers[key.row][key.col], key);
+    tap_counts[key.row][key.col] = record->tap.count;
+  }
+  process_record_with_keycode(pressed_keycodes[key.row][key.col], record);
+}
+
+void process_action(keyrecord_t* record, action_t action) {
+  const uint8_t mods = mods_5bit_to_8bit((action.code >> 8) & 0x1F);
+  if (record->event.pressed) {
+    register_mods(mods);
+  } else {
+    unregister_mods(mods);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tap-hold resolution.
+////////////////////////////////////////////////////////////////////////////////
+
+#define MAX_WAITING_EVENTS 16
+
+// The tap-hold key currently undecided between tap and hold, if any.
+static struct {
+  bool active;
+  uint16_t keycode;
+  keyrecord_t record;
+} tapping = {0};
+// Events that arrived while `tapping` was undecided, replayed once it settles.
+static keyrecord_t waiting[MAX_WAITING_EVENTS];
+static uint8_t num_waiting = 0;
+// Previous key press, for Flow Tap.
+static uint16_t prev_press_keycode = KC_NO;
+static uint16_t prev_press_time = 0;
+
+// Like QMK's default for split keyboards: the first half of the rows are left.
+__attribute__((weak)) char chordal_hold_handedness(keypos_t key) {
+  return key.row < MATRIX_ROWS / 2 ? 'L' : 'R';
+}
+
+bool get_chordal_hold_default(keyrecord_t* tap_hold_record,
+                              keyrecord_t* other_record) {
+  if (!IS_KEYEVENT(tap_hold_record->event) ||
+      !IS_KEYEVENT(other_record->event)) {
+    return true;
+  }
+  const char left = chordal_hold_handedness(tap_hold_record->event.key);
+  const char right = chordal_hold_handedness(other_record->event.key);
+  if (left == '*' || right == '*') {
+    return true;
+  }
+  return left != right;
+}
+
+static bool is_tap_hold(uint16_t keycode) {
+  return IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode);
+}
+
+static void handle_event(keyrecord_t* record);
+
+static void replay_waiting(void) {
+  keyrecord_t events[MAX_WAITING_EVENTS];
+  const uint8_t n = num_waiting;
+  memcpy(events, waiting, n * sizeof(keyrecord_t));
+  num_waiting = 0;
+  for (uint8_t i = 0; i < n; ++i) {
+    handle_event(&events[i]);
+  }
+}
+
+static void settle_tapping(bool tap) {
+  tapping.active = false;
+  tapping.record.tap.count = tap ? 1 : 0;
+  process_record(&tapping.record);
+}
+
+static bool is_waiting_press(keypos_t key) {
+  for (uint8_t i = 0; i < num_waiting; ++i) {
+    if (waiting[i].event.pressed && waiting[i].event.key.row == key.row &&
+        waiting[i].event.key.col == key.col) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void handle_event(keyrecord_t* record) {
+  const keypos_t key = record->event.key;
+
+  if (tapping.active) {
+    const keypos_t tap_key = tapping.record.event.key;
+    if (key.row == tap_key.row && key.col == tap_key.col) {
+      if (!record->event.pressed) {  // Released within the tapping term: tap.
+        settle_tapping(true);
+        record->tap.count = 1;
+        process_record(record);
+        replay_waiting();
+      }
+      return;
+    }
+
+    if (record->event.pressed) {
+#ifdef CHORDAL_HOLD
+      if (num_waiting == 0) {
+        const uint16_t other_keycode = sim_resolve_keycode(key.row, key.col);
+        if (!SIM_TIMED(SIM_STAT_CHORDAL_HOLD,
+                       get_chordal_hold(tapping.keycode, &tapping.record,
+                                        other_keycode, record))) {
+          settle_tapping(true);  // Same-hand chord: settle as tapped.
+          handle_event(record);
+          return;
+        }
+      }
+#endif  // CHORDAL_HOLD
+      if (num_waiting < MAX_WAITING_EVENTS) {
+        waiting[num_waiting++] = *record;
+      }
+      return;
+    }
+
+#ifdef PERMISSIVE_HOLD
+    if (is_waiting_press(key)) {
+      // Another key was pressed and released within the tapping term.
+      settle_tapping(false);
+      replay_waiting();
+      handle_event(record);
+      return;
+    }
+#endif  // PERMISSIVE_HOLD
+    if (is_waiting_press(key) && num_waiting < MAX_WAITING_EVENTS) {
+      waiting[num_waiting++] = *record;
+      return;
+    }
+    record->tap.count = tap_counts[key.row][key.col];
+    process_record(record);
+    return;
+  }
+
+  if (!record->event.pressed) {
+    record->tap.count = tap_counts[key.row][key.col];
+    process_record(record);
+    return;
+  }
+
+  const uint16_t keycode = sim_resolve_keycode(key.row, key.col);
+  const uint16_t prev_keycode = prev_press_keycode;
+  const uint16_t prev_time = prev_press_time;
+  prev_press_keycode = keycode;
+  prev_press_time = record->event.time;
+
+  if (is_tap_hold(keycode)) {
+#ifdef FLOW_TAP_TERM
+    const uint16_t flow_tap_term = SIM_TIMED(
+        SIM_STAT_FLOW_TAP, get_flow_tap_term(keycode, record, prev_keycode));
+    if (flow_tap_term && prev_keycode != KC_NO &&
+        (uint16_t)(record->event.time - prev_time) < flow_tap_term) {
+      record->tap.count = 1;  // Typing quickly: settle as tapped right away.
+      process_record(record);
+      return;
+    }
+#endif  // FLOW_TAP_TERM
+    tapping.active = true;
+    tapping.keycode = keycode;
+    tapping.record = *record;
+    return;
+  }
+
+  record->tap.count = 0;
+  process_record(record);
+}
+
+static void tapping_task(void) {
+  if (tapping.active) {
+    const uint16_t term = SIM_TIMED(
+        SIM_STAT_TAPPING_TERM, get_tapping_term(tapping.keycode, &tapping.record));
+    if ((uint16_t)(timer_read() - tapping.record.event.time) >= term) {
+      settle_tapping(false);  // Held past the tapping term.
+      replay_waiting();
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Driver interface.
+////////////////////////////////////////////////////////////////////////////////
+
+static void end_stall(void) {
+  const uint32_t stall = now_ms - stall_start_ms;
+  if (stall > sim_counters.longest_stall_ms) {
+    sim_counters.longest_stall_ms = stall;
+  }
+}
+
+static void matrix_scan_task(void) {
+  stall_start_ms = now_ms;
+  tapping_task();
+  deferred_exec_task();
+#if defined(CAPS_WORD_ENABLE) && CAPS_WORD_IDLE_TIMEOUT > 0
+  caps_word_task();
+#endif
+#if defined(LAYER_LOCK_ENABLE) && LAYER_LOCK_IDLE_TIMEOUT > 0
+  layer_lock_task();
+#endif
+  SIM_TIMED_VOID(SIM_STAT_HOUSEKEEPING, housekeeping_task_user());
+  end_stall();
+}
+
+void sim_init(os_variant_t os) {
+  host_os = os;
+#ifdef AUTOCORRECTION_FLASH_ENABLE
+  autocorrection_flash_erase(0, sizeof(autocorrection_flash));
+#endif  // AUTOCORRECTION_FLASH_ENABLE
+  now_ms = 1;
+  default_layer_state = 1;
+  layer_state = 0;
+  SIM_TIMED_VOID(SIM_STAT_HOUSEKEEPING, keyboard_post_init_user());
+  layer_state_set(0);
+  // As when OS Detection settles on the keyboard, after start up.
+  if (os != OS_UNSURE) {
+    process_detected_host_os_user(os);
+  }
+}
+
+void sim_advance_to(uint32_t time_ms) {
+  while (now_ms < time_ms) {
+    ++now_ms;
+    matrix_scan_task();
+  }
+}
+
+// keymap.c defines pre_process_record_user() only with some features enabled.
+__attribute__((weak)) bool pre_process_record_user(uint16_t keycode,
+                                                   keyrecord_t* record) {
+  return true;
+}
+
+void sim_key_event(uint8_t row, uint8_t col, bool pressed) {
+  keyrecord_t record = {
+      .event = {.key = {.col = col, .row = row},
+                .time = timer_read(),
+                .type = KEY_EVENT,
+                .pressed = pressed},
+  };
+  ++sim_counters.key_events;
+  stall_start_ms = now_ms;
+  const uint64_t start_ns = sim_clock_ns();
+  if (SIM_TIMED(SIM_STAT_PRE_PROCESS_RECORD_USER,
+                pre_process_record_user(sim_resolve_keycode(row, col),
+                                        &record))) {
+    handle_event(&record);
+  }
+  sim_stat_add(SIM_STAT_EVENT, sim_clock_ns() - start_ns);
+  end_stall();
+}